@@ -8,7 +8,27 @@ CONFIG -= app_bundle
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
 SOURCES += \
-    rebel_food_truck_inventory_sales.cpp
+    catalog.cpp \
+    ingredient_lots.cpp \
+    inventory_publication.cpp \
+    order_entry.cpp \
+    rebel_food_truck_inventory_sales.cpp \
+    sales_counters.cpp \
+    sales_export.cpp \
+    terminal_renderer.cpp \
+    truck_configuration.cpp
+
+HEADERS += \
+    catalog.h \
+    ingredient_lots.h \
+    inventory_publication.h \
+    order_entry.h \
+    sales_counters.h \
+    sales_export.h \
+    terminal_renderer.h \
+    truck_configuration.h
+
+unix:!macx: LIBS += -lrt
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
@@ -17,4 +37,5 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 
 DISTFILES += \
     LICENSE \
-    README.md
+    README.md \
+    rebel_food_truck.cfg
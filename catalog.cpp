@@ -0,0 +1,721 @@
+//================================================================================
+// Name        : catalog.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Catalog of ingredients and menu items with stable codes, hashed
+//               code lookup, recipes, and incrementally updated availability
+//================================================================================
+
+#include "catalog.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+static bool isValidCatalogCode(const std::string &code);
+static std::uint64_t hashCatalogCode(const char *code);
+static bool isSameCatalogCode(const std::string &storedCode, const char *code);
+static bool containsIgnoringCase(const std::string &text, const std::string &filterText);
+static void recalculateItemAvailability(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t itemIndex);
+static void recalculateIngredientItems(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex);
+static void markIngredientChanged(catalogInventory &inventory, std::uint32_t ingredientIndex);
+static void addIngredientStock(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex, std::int64_t quantity, std::int64_t currentTime);
+
+/**
+ * @brief findCodeIndex looks up a code in a code index with linear probing.
+ * @param codeIndex = Code index to search
+ * @param entries = Ingredients or items the index refers to
+ * @param code = Null-terminated code to find (case-insensitive)
+ * @return = Index of entry, or -1 if not found
+ */
+
+template <typename Entry>
+static std::int32_t findCodeIndex(const catalogCodeIndex &codeIndex, const std::vector<Entry> &entries, const char *code) {
+    if (codeIndex.slots.empty()) {
+        return -1;
+    }
+
+    std::size_t slotMask = codeIndex.slots.size() - 1;
+    for (std::size_t slot = hashCatalogCode(code) & slotMask; codeIndex.slots[slot] != 0; slot = (slot + 1) & slotMask) {
+        std::uint32_t entryIndex = codeIndex.slots[slot] - 1;
+        if (isSameCatalogCode(entries[entryIndex].code, code)) {
+            return static_cast<std::int32_t>(entryIndex);
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief insertCodeIndex adds the code of the last entry to a code index, doubling the table to keep it at most half
+ *        full so probes stay short.
+ * @param codeIndex = Code index to update passed by reference
+ * @param entries = Ingredients or items the index refers to, with the new entry last
+ */
+
+template <typename Entry>
+static void insertCodeIndex(catalogCodeIndex &codeIndex, const std::vector<Entry> &entries) {
+    // Grow and rehash every entry when needed.
+    if ((codeIndex.count + 1) * 2 > codeIndex.slots.size()) {
+        std::size_t slotCount = codeIndex.slots.empty() ? 16 : codeIndex.slots.size() * 2;
+        codeIndex.slots.assign(slotCount, 0);
+        codeIndex.count = 0;
+        for (std::uint32_t i = 0; i + 1 < entries.size(); ++i) {
+            std::size_t slot = hashCatalogCode(entries[i].code.c_str()) & (slotCount - 1);
+            while (codeIndex.slots[slot] != 0) {
+                slot = (slot + 1) & (slotCount - 1);
+            }
+            codeIndex.slots[slot] = i + 1;
+            ++codeIndex.count;
+        }
+    }
+
+    std::size_t slotMask = codeIndex.slots.size() - 1;
+    std::size_t slot = hashCatalogCode(entries.back().code.c_str()) & slotMask;
+    while (codeIndex.slots[slot] != 0) {
+        slot = (slot + 1) & slotMask;
+    }
+    codeIndex.slots[slot] = static_cast<std::uint32_t>(entries.size());
+    ++codeIndex.count;
+}
+
+/**
+ * @brief clearCatalog removes every ingredient and item.
+ * @param catalog = Catalog to clear passed by reference
+ */
+
+void clearCatalog(truckCatalog &catalog) {
+    catalog.ingredients.clear();
+    catalog.items.clear();
+    catalog.recipeComponents.clear();
+    catalog.ingredientItems.clear();
+    catalog.ingredientCodeIndex.slots.clear();
+    catalog.ingredientCodeIndex.count = 0;
+    catalog.itemCodeIndex.slots.clear();
+    catalog.itemCodeIndex.count = 0;
+    catalog.hasPerishableIngredients = false;
+}
+
+/**
+ * @brief addCatalogIngredient adds an ingredient. finalizeCatalog() must be called after the last addition.
+ * @param catalog = Catalog to update passed by reference
+ * @param code = Unique ingredient code
+ * @param label = Inventory table label
+ * @param promptName = Name used in prompts and warnings
+ * @param unit = Unit shown after inventory (may be empty)
+ * @param capacity = Max capacity (1 to MAX_CATALOG_CAPACITY)
+ * @param shelfLife = Seconds stock keeps after restocking, or 0 if it never expires
+ * @return = catalogError enum representing the result of adding the ingredient
+ */
+
+catalogError addCatalogIngredient(truckCatalog &catalog, const std::string &code, const std::string &label, const std::string &promptName, const std::string &unit, std::int64_t capacity, std::int64_t shelfLife) {
+    if (!isValidCatalogCode(code)) {
+        return CATALOG_INVALID_CODE;
+    } else if (findCatalogIngredient(catalog, code.c_str()) >= 0) {
+        return CATALOG_DUPLICATE_CODE;
+    } else if (label.empty() || promptName.empty() || capacity < 1 || capacity > MAX_CATALOG_CAPACITY || shelfLife < 0) {
+        return CATALOG_INVALID_VALUE;
+    }
+
+    catalogIngredient ingredient;
+    ingredient.code = code;
+    for (std::string::size_type i = 0; i < ingredient.code.size(); ++i) {
+        ingredient.code[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(ingredient.code[i])));
+    }
+    ingredient.label        = label;
+    ingredient.promptName   = promptName;
+    ingredient.unit         = unit;
+    ingredient.capacity     = capacity;
+    ingredient.lowInventory = 0;
+    ingredient.shelfLife    = shelfLife;
+    ingredient.itemStart    = 0;
+    ingredient.itemCount    = 0;
+    catalog.ingredients.push_back(ingredient);
+    insertCodeIndex(catalog.ingredientCodeIndex, catalog.ingredients);
+
+    return CATALOG_SUCCESS;
+}
+
+/**
+ * @brief addCatalogItem adds an item with a recipe such as "PATTY:1 BUN:1 CHILI:4". Every ingredient in the recipe must
+ *        already be in the catalog, and amounts of an ingredient listed more than once are added together. Each
+ *        ingredient's amount must be 1 to MAX_CATALOG_RECIPE_AMOUNT. finalizeCatalog() must be called after the last
+ *        addition.
+ * @param catalog = Catalog to update passed by reference
+ * @param code = Unique item code
+ * @param label = Sell table label
+ * @param pluralName = Name used in quantity messages
+ * @param price = Price per item
+ * @param recipeText = Null-terminated ingredient code and amount pairs separated by spaces or commas
+ * @return = catalogError enum representing the result of adding the item
+ */
+
+catalogError addCatalogItem(truckCatalog &catalog, const std::string &code, const std::string &label, const std::string &pluralName, double price, const char *recipeText) {
+    if (!isValidCatalogCode(code)) {
+        return CATALOG_INVALID_CODE;
+    } else if (findCatalogItem(catalog, code.c_str()) >= 0) {
+        return CATALOG_DUPLICATE_CODE;
+    } else if (label.empty() || pluralName.empty() || !(price >= 0) || std::isinf(price)) {
+        return CATALOG_INVALID_VALUE;
+    }
+
+    catalogItem item;
+    item.code = code;
+    for (std::string::size_type i = 0; i < item.code.size(); ++i) {
+        item.code[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(item.code[i])));
+    }
+    item.label       = label;
+    item.pluralName  = pluralName;
+    item.price       = price;
+    item.recipeStart = static_cast<std::uint32_t>(catalog.recipeComponents.size());
+    item.recipeCount = 0;
+
+    // Parse recipe components.
+    const char *character = recipeText;
+    char ingredientCode[MAX_CATALOG_CODE_LENGTH + 1];
+    for (;;) {
+        while (*character == ' ' || *character == '\t' || *character == ',') {
+            ++character;
+        }
+        if (*character == '\0') {
+            break;
+        }
+
+        // Ingredient code up to ':'
+        int codeLength = 0;
+        while (*character != ':' && *character != '\0' && *character != ' ' && *character != ',') {
+            if (codeLength == MAX_CATALOG_CODE_LENGTH) {
+                catalog.recipeComponents.resize(item.recipeStart);
+                return CATALOG_INVALID_RECIPE;
+            }
+            ingredientCode[codeLength++] = *character++;
+        }
+        ingredientCode[codeLength] = '\0';
+        if (*character != ':') {
+            catalog.recipeComponents.resize(item.recipeStart);
+            return CATALOG_INVALID_RECIPE;
+        }
+        ++character;
+
+        std::int32_t ingredientIndex = findCatalogIngredient(catalog, ingredientCode);
+        if (ingredientIndex < 0) {
+            catalog.recipeComponents.resize(item.recipeStart);
+            return CATALOG_UNKNOWN_INGREDIENT;
+        }
+
+        // Amount
+        char *end;
+        errno = 0;
+        long long amount = std::strtoll(character, &end, 10);
+        if (end == character || errno == ERANGE || amount < 1 || amount > MAX_CATALOG_RECIPE_AMOUNT || (*end != '\0' && *end != ' ' && *end != '\t' && *end != ',')) {
+            catalog.recipeComponents.resize(item.recipeStart);
+            return CATALOG_INVALID_RECIPE;
+        }
+        character = end;
+
+        // Add to the ingredient if the recipe already lists it, so each ingredient appears once per item.
+        std::uint32_t componentIndex = item.recipeStart;
+        while (componentIndex < item.recipeStart + item.recipeCount && catalog.recipeComponents[componentIndex].ingredientIndex != static_cast<std::uint32_t>(ingredientIndex)) {
+            ++componentIndex;
+        }
+        if (componentIndex < item.recipeStart + item.recipeCount) {
+            if (catalog.recipeComponents[componentIndex].amount + amount > MAX_CATALOG_RECIPE_AMOUNT) {
+                catalog.recipeComponents.resize(item.recipeStart);
+                return CATALOG_INVALID_RECIPE;
+            }
+            catalog.recipeComponents[componentIndex].amount += amount;
+            continue;
+        }
+
+        catalogRecipeComponent component;
+        component.ingredientIndex = static_cast<std::uint32_t>(ingredientIndex);
+        component.amount = amount;
+        catalog.recipeComponents.push_back(component);
+        ++item.recipeCount;
+    }
+
+    if (item.recipeCount == 0) {
+        return CATALOG_INVALID_RECIPE;
+    }
+
+    catalog.items.push_back(item);
+    insertCodeIndex(catalog.itemCodeIndex, catalog.items);
+
+    return CATALOG_SUCCESS;
+}
+
+/**
+ * @brief finalizeCatalog calculates low inventory thresholds and builds the list of items using each ingredient, so
+ *        changing one ingredient only recalculates the items that use it.
+ * @param catalog = Catalog to finalize passed by reference
+ * @param lowInventoryThreshold = Fraction of capacity at which inventory is low
+ */
+
+void finalizeCatalog(truckCatalog &catalog, double lowInventoryThreshold) {
+    catalog.hasPerishableIngredients = false;
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        catalog.ingredients[i].lowInventory = static_cast<std::int64_t>(std::floor(static_cast<double>(catalog.ingredients[i].capacity) * lowInventoryThreshold));
+        catalog.ingredients[i].itemCount = 0;
+        if (catalog.ingredients[i].shelfLife > 0) {
+            catalog.hasPerishableIngredients = true;
+        }
+    }
+
+    // Count items using each ingredient, then assign each ingredient its range.
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        const catalogItem &item = catalog.items[i];
+        for (std::uint32_t j = item.recipeStart; j < item.recipeStart + item.recipeCount; ++j) {
+            ++catalog.ingredients[catalog.recipeComponents[j].ingredientIndex].itemCount;
+        }
+    }
+    std::uint32_t itemStart = 0;
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        catalog.ingredients[i].itemStart = itemStart;
+        itemStart += catalog.ingredients[i].itemCount;
+        catalog.ingredients[i].itemCount = 0;
+    }
+
+    // Fill ranges.
+    catalog.ingredientItems.assign(itemStart, 0);
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        const catalogItem &item = catalog.items[i];
+        for (std::uint32_t j = item.recipeStart; j < item.recipeStart + item.recipeCount; ++j) {
+            catalogIngredient &ingredient = catalog.ingredients[catalog.recipeComponents[j].ingredientIndex];
+            catalog.ingredientItems[ingredient.itemStart + ingredient.itemCount++] = i;
+        }
+    }
+}
+
+/**
+ * @brief getCatalogErrorMessage returns a printable description of a catalog error.
+ * @param errorResult = catalogError enum to describe
+ * @return = Null-terminated byte string constant describing the error
+ */
+
+const char *getCatalogErrorMessage(catalogError errorResult) {
+    if (errorResult == CATALOG_SUCCESS) {
+        return "Catalog entry added.";
+    } else if (errorResult == CATALOG_INVALID_CODE) {
+        return "Invalid catalog code.";
+    } else if (errorResult == CATALOG_DUPLICATE_CODE) {
+        return "Duplicate catalog code.";
+    } else if (errorResult == CATALOG_INVALID_VALUE) {
+        return "Invalid catalog value.";
+    } else if (errorResult == CATALOG_UNKNOWN_INGREDIENT) {
+        return "Recipe uses an unknown ingredient.";
+    } else {
+        return "Invalid recipe.";
+    }
+}
+
+/**
+ * @brief findCatalogIngredient looks up an ingredient by code in constant expected time.
+ * @param catalog = Catalog to search
+ * @param code = Null-terminated code to find (case-insensitive)
+ * @return = Index of ingredient, or -1 if not found
+ */
+
+std::int32_t findCatalogIngredient(const truckCatalog &catalog, const char *code) {
+    return findCodeIndex(catalog.ingredientCodeIndex, catalog.ingredients, code);
+}
+
+/**
+ * @brief findCatalogItem looks up an item by code in constant expected time.
+ * @param catalog = Catalog to search
+ * @param code = Null-terminated code to find (case-insensitive)
+ * @return = Index of item, or -1 if not found
+ */
+
+std::int32_t findCatalogItem(const truckCatalog &catalog, const char *code) {
+    return findCodeIndex(catalog.itemCodeIndex, catalog.items, code);
+}
+
+/**
+ * @brief filterCatalogIngredients lists ingredients whose code or label contains the filter text (case-insensitive).
+ * @param visibleIngredients = Vector to receive ingredient indexes in catalog order passed by reference
+ * @param catalog = Catalog to filter
+ * @param filterText = Text to match (empty matches every ingredient)
+ */
+
+void filterCatalogIngredients(std::vector<std::uint32_t> &visibleIngredients, const truckCatalog &catalog, const std::string &filterText) {
+    visibleIngredients.clear();
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        if (containsIgnoringCase(catalog.ingredients[i].code, filterText) || containsIgnoringCase(catalog.ingredients[i].label, filterText)) {
+            visibleIngredients.push_back(i);
+        }
+    }
+}
+
+/**
+ * @brief filterCatalogItems lists items whose code or label contains the filter text (case-insensitive).
+ * @param visibleItems = Vector to receive item indexes in catalog order passed by reference
+ * @param catalog = Catalog to filter
+ * @param filterText = Text to match (empty matches every item)
+ */
+
+void filterCatalogItems(std::vector<std::uint32_t> &visibleItems, const truckCatalog &catalog, const std::string &filterText) {
+    visibleItems.clear();
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        if (containsIgnoringCase(catalog.items[i].code, filterText) || containsIgnoringCase(catalog.items[i].label, filterText)) {
+            visibleItems.push_back(i);
+        }
+    }
+}
+
+/**
+ * @brief initializeCatalogInventory fills every ingredient to capacity with one fresh lot and calculates availability
+ *        of every item.
+ * @param inventory = Inventory to initialize passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param currentTime = Current time in seconds since the epoch
+ */
+
+void initializeCatalogInventory(catalogInventory &inventory, const truckCatalog &catalog, std::int64_t currentTime) {
+    inventory.ingredientInventories.assign(catalog.ingredients.size(), 0);
+    inventory.ingredientLots.resize(catalog.ingredients.size());
+    inventory.lotExpiries.clear();
+    inventory.lotExpiryCompactionSize = 2 * catalog.ingredients.size();
+    inventory.ingredientExpired.assign(catalog.ingredients.size(), 0);
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        clearIngredientLots(inventory.ingredientLots[i]);
+        addIngredientStock(inventory, catalog, i, catalog.ingredients[i].capacity, currentTime);
+    }
+
+    // Every entry counts as changed.
+    inventory.itemAvailability.assign(catalog.items.size(), 0);
+    inventory.isIngredientChanged.assign(catalog.ingredients.size(), false);
+    inventory.isItemChanged.assign(catalog.items.size(), false);
+    inventory.changedIngredients.clear();
+    inventory.changedItems.clear();
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        markIngredientChanged(inventory, i);
+    }
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        inventory.isItemChanged[i] = true;
+        inventory.changedItems.push_back(i);
+        recalculateItemAvailability(inventory, catalog, i);
+    }
+}
+
+/**
+ * @brief transferCatalogInventory carries lots and expired totals over to a new catalog by ingredient code. Inventory
+ *        over the new capacity is removed oldest lot first. Ingredients new to the catalog start at capacity.
+ * @param newInventory = Inventory for the new catalog passed by reference
+ * @param newCatalog = New catalog
+ * @param oldInventory = Inventory for the old catalog
+ * @param oldCatalog = Old catalog
+ * @param currentTime = Current time in seconds since the epoch
+ */
+
+void transferCatalogInventory(catalogInventory &newInventory, const truckCatalog &newCatalog, const catalogInventory &oldInventory, const truckCatalog &oldCatalog, std::int64_t currentTime) {
+    initializeCatalogInventory(newInventory, newCatalog, currentTime);
+    newInventory.lotExpiries.clear();
+
+    for (std::uint32_t i = 0; i < newCatalog.ingredients.size(); ++i) {
+        std::int32_t oldIngredientIndex = findCatalogIngredient(oldCatalog, newCatalog.ingredients[i].code.c_str());
+        if (oldIngredientIndex >= 0) {
+            newInventory.ingredientLots[i] = oldInventory.ingredientLots[oldIngredientIndex];
+            newInventory.ingredientExpired[i] = oldInventory.ingredientExpired[oldIngredientIndex];
+            newInventory.ingredientInventories[i] = std::min(oldInventory.ingredientInventories[oldIngredientIndex], newCatalog.ingredients[i].capacity);
+            consumeIngredientLots(newInventory.ingredientLots[i], oldInventory.ingredientInventories[oldIngredientIndex] - newInventory.ingredientInventories[i]);
+        }
+
+        // Schedule expiry of every lot held, since ingredient indexes may have changed.
+        const ingredientLotQueue &lotQueue = newInventory.ingredientLots[i];
+        for (std::uint32_t j = 0; j < lotQueue.count; ++j) {
+            const ingredientLot &lot = lotQueue.lots[(lotQueue.head + j) % MAX_INGREDIENT_LOTS];
+            if (lot.quantity > 0 && lot.expiryTime != LOT_NEVER_EXPIRES) {
+                lotExpiryEntry entry;
+                entry.expiryTime = lot.expiryTime;
+                entry.lotSequence = lotQueue.headSequence + j;
+                entry.ingredientIndex = i;
+                pushLotExpiry(newInventory.lotExpiries, entry);
+            }
+        }
+    }
+    newInventory.lotExpiryCompactionSize = 2 * std::max(newInventory.lotExpiries.size(), newInventory.ingredientLots.size());
+
+    for (std::uint32_t i = 0; i < newCatalog.items.size(); ++i) {
+        recalculateItemAvailability(newInventory, newCatalog, i);
+    }
+}
+
+/**
+ * @brief setIngredientInventory replaces an ingredient's inventory and recalculates only the items that use it. An
+ *        increase is received as a fresh lot; a decrease is removed oldest lot first.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param ingredientIndex = Index of ingredient
+ * @param newInventory = New inventory
+ * @param currentTime = Current time in seconds since the epoch
+ */
+
+void setIngredientInventory(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex, std::int64_t newInventory, std::int64_t currentTime) {
+    std::int64_t inventoryChange = newInventory - inventory.ingredientInventories[ingredientIndex];
+    if (inventoryChange > 0) {
+        addIngredientStock(inventory, catalog, ingredientIndex, inventoryChange, currentTime);
+    } else if (inventoryChange < 0) {
+        consumeIngredientLots(inventory.ingredientLots[ingredientIndex], -inventoryChange);
+        inventory.ingredientInventories[ingredientIndex] = newInventory;
+    }
+    markIngredientChanged(inventory, ingredientIndex);
+    recalculateIngredientItems(inventory, catalog, ingredientIndex);
+}
+
+/**
+ * @brief sellCatalogItem removes the ingredients for a quantity of an item and recalculates only the items sharing
+ *        those ingredients.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param itemIndex = Index of item
+ * @param quantity = Quantity sold (at most the item's availability)
+ */
+
+void sellCatalogItem(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t itemIndex, std::int64_t quantity) {
+    const catalogItem &item = catalog.items[itemIndex];
+
+    for (std::uint32_t i = item.recipeStart; i < item.recipeStart + item.recipeCount; ++i) {
+        const catalogRecipeComponent &component = catalog.recipeComponents[i];
+        inventory.ingredientInventories[component.ingredientIndex] -= component.amount * quantity;
+        consumeIngredientLots(inventory.ingredientLots[component.ingredientIndex], component.amount * quantity);
+        markIngredientChanged(inventory, component.ingredientIndex);
+    }
+    for (std::uint32_t i = item.recipeStart; i < item.recipeStart + item.recipeCount; ++i) {
+        recalculateIngredientItems(inventory, catalog, catalog.recipeComponents[i].ingredientIndex);
+    }
+}
+
+/**
+ * @brief expireCatalogInventory removes every lot whose expiry time has passed and adds it to the ingredient's expired
+ *        total. Only due expiries are visited, so a sweep with nothing due is constant time.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param currentTime = Current time in seconds since the epoch
+ * @param expiredStock = Vector to receive quantity removed from each ingredient passed by reference
+ */
+
+void expireCatalogInventory(catalogInventory &inventory, const truckCatalog &catalog, std::int64_t currentTime, std::vector<catalogExpiredStock> &expiredStock) {
+    expiredStock.clear();
+
+    lotExpiryEntry entry;
+    while (popDueLotExpiry(inventory.lotExpiries, currentTime, entry)) {
+        std::int64_t quantityExpired = expireIngredientLot(inventory.ingredientLots[entry.ingredientIndex], entry.lotSequence, currentTime);
+        if (quantityExpired == 0) {
+            continue;
+        }
+
+        inventory.ingredientInventories[entry.ingredientIndex] -= quantityExpired;
+        inventory.ingredientExpired[entry.ingredientIndex] += quantityExpired;
+        markIngredientChanged(inventory, entry.ingredientIndex);
+        recalculateIngredientItems(inventory, catalog, entry.ingredientIndex);
+
+        // Add to the ingredient's entry if one exists.
+        std::uint32_t i = 0;
+        while (i < expiredStock.size() && expiredStock[i].ingredientIndex != entry.ingredientIndex) {
+            ++i;
+        }
+        if (i == expiredStock.size()) {
+            catalogExpiredStock stock;
+            stock.ingredientIndex = entry.ingredientIndex;
+            stock.quantity = 0;
+            expiredStock.push_back(stock);
+        }
+        expiredStock[i].quantity += quantityExpired;
+    }
+}
+
+/**
+ * @brief clearCatalogInventoryChanges forgets which entries changed.
+ * @param inventory = Inventory to update passed by reference
+ */
+
+void clearCatalogInventoryChanges(catalogInventory &inventory) {
+    for (std::uint32_t i = 0; i < inventory.changedIngredients.size(); ++i) {
+        inventory.isIngredientChanged[inventory.changedIngredients[i]] = false;
+    }
+    for (std::uint32_t i = 0; i < inventory.changedItems.size(); ++i) {
+        inventory.isItemChanged[inventory.changedItems[i]] = false;
+    }
+    inventory.changedIngredients.clear();
+    inventory.changedItems.clear();
+}
+
+/**
+ * @brief isValidCatalogCode determines if a code starts with a letter, contains only letters, digits, '_' and '-', and
+ *        fits MAX_CATALOG_CODE_LENGTH. Codes never look like option numbers or order lines, and never match a page
+ *        command.
+ * @param code = Code to check
+ * @return = Boolean indicating whether the code is valid
+ */
+
+static bool isValidCatalogCode(const std::string &code) {
+    if (code.empty() || code.size() > static_cast<std::string::size_type>(MAX_CATALOG_CODE_LENGTH) || !std::isalpha(static_cast<unsigned char>(code[0]))) {
+        return false;
+    } else if (code.size() == 1 && (std::toupper(static_cast<unsigned char>(code[0])) == 'N' || std::toupper(static_cast<unsigned char>(code[0])) == 'P')) {
+        // Page commands at the menu prompts
+        return false;
+    }
+    for (std::string::size_type i = 1; i < code.size(); ++i) {
+        if (!std::isalnum(static_cast<unsigned char>(code[i])) && code[i] != '_' && code[i] != '-') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief hashCatalogCode hashes a code with FNV-1a, ignoring case.
+ * @param code = Null-terminated code
+ * @return = 64-bit hash
+ */
+
+static std::uint64_t hashCatalogCode(const char *code) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (; *code != '\0'; ++code) {
+        hash ^= static_cast<std::uint64_t>(std::toupper(static_cast<unsigned char>(*code)));
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief isSameCatalogCode compares a stored (uppercase) code with a code in any case.
+ * @param storedCode = Stored code
+ * @param code = Null-terminated code
+ * @return = Boolean indicating whether the codes match
+ */
+
+static bool isSameCatalogCode(const std::string &storedCode, const char *code) {
+    std::string::size_type i = 0;
+    for (; i < storedCode.size() && code[i] != '\0'; ++i) {
+        if (storedCode[i] != std::toupper(static_cast<unsigned char>(code[i]))) {
+            return false;
+        }
+    }
+
+    return i == storedCode.size() && code[i] == '\0';
+}
+
+/**
+ * @brief containsIgnoringCase determines if text contains filter text, ignoring case.
+ * @param text = Text to search
+ * @param filterText = Text to find
+ * @return = Boolean indicating whether filter text was found
+ */
+
+static bool containsIgnoringCase(const std::string &text, const std::string &filterText) {
+    if (filterText.size() > text.size()) {
+        return false;
+    }
+    for (std::string::size_type start = 0; start + filterText.size() <= text.size(); ++start) {
+        std::string::size_type i = 0;
+        while (i < filterText.size() && std::tolower(static_cast<unsigned char>(text[start + i])) == std::tolower(static_cast<unsigned char>(filterText[i]))) {
+            ++i;
+        }
+        if (i == filterText.size()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief recalculateItemAvailability determines the max quantity of an item available to sell based on the ingredient
+ *        with the lowest stock for its recipe, and marks the item changed if it differs.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param itemIndex = Index of item
+ */
+
+static void recalculateItemAvailability(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t itemIndex) {
+    const catalogItem &item = catalog.items[itemIndex];
+
+    std::int64_t maxQuantityToSell = -1;
+    for (std::uint32_t i = item.recipeStart; i < item.recipeStart + item.recipeCount; ++i) {
+        const catalogRecipeComponent &component = catalog.recipeComponents[i];
+        std::int64_t servingsAvailable = inventory.ingredientInventories[component.ingredientIndex] / component.amount;
+        if (maxQuantityToSell < 0 || servingsAvailable < maxQuantityToSell) {
+            maxQuantityToSell = servingsAvailable;
+        }
+    }
+    if (maxQuantityToSell < 0) {
+        maxQuantityToSell = 0;
+    }
+
+    if (inventory.itemAvailability[itemIndex] != maxQuantityToSell) {
+        inventory.itemAvailability[itemIndex] = maxQuantityToSell;
+        if (!inventory.isItemChanged[itemIndex]) {
+            inventory.isItemChanged[itemIndex] = true;
+            inventory.changedItems.push_back(itemIndex);
+        }
+    }
+}
+
+/**
+ * @brief recalculateIngredientItems recalculates availability of every item using an ingredient.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param ingredientIndex = Index of ingredient
+ */
+
+static void recalculateIngredientItems(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex) {
+    const catalogIngredient &ingredient = catalog.ingredients[ingredientIndex];
+    for (std::uint32_t i = ingredient.itemStart; i < ingredient.itemStart + ingredient.itemCount; ++i) {
+        recalculateItemAvailability(inventory, catalog, catalog.ingredientItems[i]);
+    }
+}
+
+/**
+ * @brief markIngredientChanged lists an ingredient as changed once.
+ * @param inventory = Inventory to update passed by reference
+ * @param ingredientIndex = Index of ingredient
+ */
+
+static void markIngredientChanged(catalogInventory &inventory, std::uint32_t ingredientIndex) {
+    if (!inventory.isIngredientChanged[ingredientIndex]) {
+        inventory.isIngredientChanged[ingredientIndex] = true;
+        inventory.changedIngredients.push_back(ingredientIndex);
+    }
+}
+
+/**
+ * @brief addIngredientStock receives a quantity of an ingredient as a lot expiring one shelf life from now and
+ *        schedules its expiry. A full lot queue first merges its two oldest lots, rescheduling the merged lot if it
+ *        now expires sooner.
+ * @param inventory = Inventory to update passed by reference
+ * @param catalog = Catalog the inventory belongs to
+ * @param ingredientIndex = Index of ingredient
+ * @param quantity = Quantity received (at least 1)
+ * @param currentTime = Current time in seconds since the epoch
+ */
+
+static void addIngredientStock(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex, std::int64_t quantity, std::int64_t currentTime) {
+    const catalogIngredient &ingredient = catalog.ingredients[ingredientIndex];
+
+    ingredientLotQueue &lotQueue = inventory.ingredientLots[ingredientIndex];
+
+    lotExpiryEntry entry;
+    entry.ingredientIndex = ingredientIndex;
+    if (lotQueue.count == static_cast<std::uint32_t>(MAX_INGREDIENT_LOTS) && mergeOldestIngredientLots(lotQueue, entry.lotSequence)) {
+        entry.expiryTime = getOldestLotExpiry(lotQueue);
+        pushLotExpiry(inventory.lotExpiries, entry);
+    }
+    entry.expiryTime = ingredient.shelfLife > 0 ? currentTime + ingredient.shelfLife : LOT_NEVER_EXPIRES;
+    if (addIngredientLot(lotQueue, quantity, entry.expiryTime, entry.lotSequence)) {
+        pushLotExpiry(inventory.lotExpiries, entry);
+    }
+    inventory.ingredientInventories[ingredientIndex] += quantity;
+
+    // Drop entries of lots no longer held once they may outnumber the lots that are.
+    if (inventory.lotExpiries.size() > inventory.lotExpiryCompactionSize) {
+        compactLotExpiries(inventory.lotExpiries, inventory.ingredientLots);
+        inventory.lotExpiryCompactionSize = 2 * std::max(inventory.lotExpiries.size(), inventory.ingredientLots.size());
+    }
+}
@@ -0,0 +1,119 @@
+//================================================================================
+// Name        : catalog.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Catalog of ingredients and menu items with stable codes, hashed
+//               code lookup, recipes, and incrementally updated availability
+//================================================================================
+
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ingredient_lots.h"
+
+// Longest item or ingredient code accepted (codes are letters, digits, '_' and '-', starting with a letter). "N" and
+// "P" are not accepted because the menu prompts read them as page commands.
+const int MAX_CATALOG_CODE_LENGTH = 15;
+
+// Largest amount of one ingredient in one item's recipe. Keeps the ingredients of a whole order line far from integer
+// overflow.
+const std::int64_t MAX_CATALOG_RECIPE_AMOUNT = 1000000;
+
+// Largest capacity of one ingredient. Keeps inventory, its lots, and the cost of selling it all far from integer
+// overflow.
+const std::int64_t MAX_CATALOG_CAPACITY = 1000000000;
+
+enum catalogError { CATALOG_SUCCESS, CATALOG_INVALID_CODE, CATALOG_DUPLICATE_CODE, CATALOG_INVALID_VALUE, CATALOG_UNKNOWN_INGREDIENT, CATALOG_INVALID_RECIPE };
+
+// Ingredient stocked on the truck. Items using it are listed in ingredientItems[itemStart, itemStart + itemCount).
+struct catalogIngredient {
+    std::string code;
+    std::string label;      // Inventory table label (e.g. "Hamburger Patties")
+    std::string promptName; // Name used in prompts and warnings (e.g. "hamburger patty")
+    std::string unit;       // Unit shown after inventory (e.g. "oz"), empty for counts
+    std::int64_t capacity;
+    std::int64_t lowInventory;
+    std::int64_t shelfLife; // Seconds stock keeps after restocking, 0 if it never expires
+    std::uint32_t itemStart;
+    std::uint32_t itemCount;
+};
+
+// Amount of one ingredient used by one item.
+struct catalogRecipeComponent {
+    std::uint32_t ingredientIndex;
+    std::int64_t amount;
+};
+
+// Item sold. Its recipe is recipeComponents[recipeStart, recipeStart + recipeCount).
+struct catalogItem {
+    std::string code;
+    std::string label;      // Sell table label (e.g. "Hamburger")
+    std::string pluralName; // Name used in quantity messages (e.g. "hamburgers")
+    double price;
+    std::uint32_t recipeStart;
+    std::uint32_t recipeCount;
+};
+
+// Open-addressing hash table from code to index. Slots hold index + 1, or 0 when empty.
+struct catalogCodeIndex {
+    std::vector<std::uint32_t> slots;
+    std::uint32_t count;
+};
+
+struct truckCatalog {
+    std::vector<catalogIngredient> ingredients;
+    std::vector<catalogItem> items;
+    std::vector<catalogRecipeComponent> recipeComponents;
+    std::vector<std::uint32_t> ingredientItems;
+    catalogCodeIndex ingredientCodeIndex;
+    catalogCodeIndex itemCodeIndex;
+    bool hasPerishableIngredients;
+};
+
+// Current inventory for a catalog. Entries changed since the last clearCatalogInventoryChanges() are listed so
+// displays and publications can skip everything else. Each ingredient's inventory is the total of its unexpired lots,
+// so availability never counts expired stock. The expiry heap is compacted once it grows past lotExpiryCompactionSize,
+// twice the entries it held after the last compaction, so entries of used up or merged lots never outnumber the rest.
+struct catalogInventory {
+    std::vector<std::int64_t> ingredientInventories;
+    std::vector<ingredientLotQueue> ingredientLots;
+    std::vector<lotExpiryEntry> lotExpiries;
+    std::vector<lotExpiryEntry>::size_type lotExpiryCompactionSize;
+    std::vector<std::int64_t> ingredientExpired;
+    std::vector<std::int64_t> itemAvailability;
+    std::vector<std::uint32_t> changedIngredients;
+    std::vector<std::uint32_t> changedItems;
+    std::vector<bool> isIngredientChanged;
+    std::vector<bool> isItemChanged;
+};
+
+// Quantity of an ingredient removed by one expiry sweep.
+struct catalogExpiredStock {
+    std::uint32_t ingredientIndex;
+    std::int64_t quantity;
+};
+
+void clearCatalog(truckCatalog &catalog);
+catalogError addCatalogIngredient(truckCatalog &catalog, const std::string &code, const std::string &label, const std::string &promptName, const std::string &unit, std::int64_t capacity, std::int64_t shelfLife = 0);
+catalogError addCatalogItem(truckCatalog &catalog, const std::string &code, const std::string &label, const std::string &pluralName, double price, const char *recipeText);
+void finalizeCatalog(truckCatalog &catalog, double lowInventoryThreshold);
+const char *getCatalogErrorMessage(catalogError errorResult);
+
+std::int32_t findCatalogIngredient(const truckCatalog &catalog, const char *code);
+std::int32_t findCatalogItem(const truckCatalog &catalog, const char *code);
+void filterCatalogIngredients(std::vector<std::uint32_t> &visibleIngredients, const truckCatalog &catalog, const std::string &filterText);
+void filterCatalogItems(std::vector<std::uint32_t> &visibleItems, const truckCatalog &catalog, const std::string &filterText);
+
+void initializeCatalogInventory(catalogInventory &inventory, const truckCatalog &catalog, std::int64_t currentTime);
+void transferCatalogInventory(catalogInventory &newInventory, const truckCatalog &newCatalog, const catalogInventory &oldInventory, const truckCatalog &oldCatalog, std::int64_t currentTime);
+void setIngredientInventory(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t ingredientIndex, std::int64_t newInventory, std::int64_t currentTime);
+void sellCatalogItem(catalogInventory &inventory, const truckCatalog &catalog, std::uint32_t itemIndex, std::int64_t quantity);
+void expireCatalogInventory(catalogInventory &inventory, const truckCatalog &catalog, std::int64_t currentTime, std::vector<catalogExpiredStock> &expiredStock);
+void clearCatalogInventoryChanges(catalogInventory &inventory);
+
+#endif // CATALOG_H
@@ -0,0 +1,216 @@
+//================================================================================
+// Name        : ingredient_lots.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Stock of each ingredient kept as first-in, first-out lots with
+//               expiry times, and a heap of expiry times so sweeps only visit
+//               lots that are due
+//================================================================================
+
+#include "ingredient_lots.h"
+
+#include <algorithm>
+
+static void dropEmptyHeadLots(ingredientLotQueue &lotQueue);
+static bool isLotExpiryScheduled(const std::vector<ingredientLotQueue> &ingredientLots, const lotExpiryEntry &entry);
+static bool isLaterLotExpiry(const lotExpiryEntry &firstEntry, const lotExpiryEntry &secondEntry);
+
+/**
+ * @brief clearIngredientLots removes every lot.
+ * @param lotQueue = Lot queue to clear passed by reference
+ */
+
+void clearIngredientLots(ingredientLotQueue &lotQueue) {
+    lotQueue.head = 0;
+    lotQueue.count = 0;
+    lotQueue.headSequence = 0;
+}
+
+/**
+ * @brief addIngredientLot adds a lot after the newest one. The queue must not be full; mergeOldestIngredientLots()
+ *        makes room.
+ * @param lotQueue = Lot queue to update passed by reference
+ * @param quantity = Quantity received (at least 1)
+ * @param expiryTime = Expiry time in seconds since the epoch, or LOT_NEVER_EXPIRES
+ * @param lotSequence = Sequence number to receive the new lot passed by reference
+ * @return = Boolean indicating whether the lot's expiry time must be scheduled
+ */
+
+bool addIngredientLot(ingredientLotQueue &lotQueue, std::int64_t quantity, std::int64_t expiryTime, std::uint64_t &lotSequence) {
+    ingredientLot &lot = lotQueue.lots[(lotQueue.head + lotQueue.count) % MAX_INGREDIENT_LOTS];
+    lot.quantity = quantity;
+    lot.expiryTime = expiryTime;
+    lotSequence = lotQueue.headSequence + lotQueue.count;
+    ++lotQueue.count;
+
+    return expiryTime != LOT_NEVER_EXPIRES;
+}
+
+/**
+ * @brief mergeOldestIngredientLots frees a place in a full queue by moving the oldest lot into the next oldest, which
+ *        keeps the earlier of the two expiry times. Only old stock takes the earlier expiry; later restocks keep
+ *        their own. Every other lot keeps its sequence number.
+ * @param lotQueue = Lot queue with at least two lots to update passed by reference
+ * @param lotSequence = Sequence number to receive the merged lot passed by reference
+ * @return = Boolean indicating whether the merged lot's expiry time must be scheduled
+ */
+
+bool mergeOldestIngredientLots(ingredientLotQueue &lotQueue, std::uint64_t &lotSequence) {
+    ingredientLot &oldestLot = lotQueue.lots[lotQueue.head];
+    ingredientLot &mergedLot = lotQueue.lots[(lotQueue.head + 1) % MAX_INGREDIENT_LOTS];
+    lotSequence = lotQueue.headSequence + 1;
+
+    // An expired lot is empty, so it takes the oldest lot's expiry time outright.
+    bool isExpiryChanged = mergedLot.quantity == 0 ? mergedLot.expiryTime != oldestLot.expiryTime : oldestLot.expiryTime < mergedLot.expiryTime;
+    if (isExpiryChanged) {
+        mergedLot.expiryTime = oldestLot.expiryTime;
+    }
+    mergedLot.quantity += oldestLot.quantity;
+    oldestLot.quantity = 0;
+    dropEmptyHeadLots(lotQueue);
+
+    return isExpiryChanged && mergedLot.expiryTime != LOT_NEVER_EXPIRES;
+}
+
+/**
+ * @brief consumeIngredientLots removes a quantity oldest lot first. Each lot emptied is dropped, so this is amortized
+ *        constant time per sale.
+ * @param lotQueue = Lot queue to update passed by reference
+ * @param quantity = Quantity to remove (at most the quantity held)
+ */
+
+void consumeIngredientLots(ingredientLotQueue &lotQueue, std::int64_t quantity) {
+    while (quantity > 0 && lotQueue.count > 0) {
+        ingredientLot &lot = lotQueue.lots[lotQueue.head];
+        std::int64_t quantityTaken = std::min(lot.quantity, quantity);
+        lot.quantity -= quantityTaken;
+        quantity -= quantityTaken;
+        dropEmptyHeadLots(lotQueue);
+    }
+}
+
+/**
+ * @brief expireIngredientLot empties a lot if it is still held and its expiry time has passed.
+ * @param lotQueue = Lot queue to update passed by reference
+ * @param lotSequence = Sequence number of lot
+ * @param currentTime = Current time in seconds since the epoch
+ * @return = Quantity removed (0 if the lot was already used up or expires later)
+ */
+
+std::int64_t expireIngredientLot(ingredientLotQueue &lotQueue, std::uint64_t lotSequence, std::int64_t currentTime) {
+    if (lotSequence < lotQueue.headSequence || lotSequence >= lotQueue.headSequence + lotQueue.count) {
+        return 0;
+    }
+
+    ingredientLot &lot = lotQueue.lots[(lotQueue.head + (lotSequence - lotQueue.headSequence)) % MAX_INGREDIENT_LOTS];
+    if (lot.expiryTime > currentTime) {
+        return 0;
+    }
+
+    std::int64_t quantityExpired = lot.quantity;
+    lot.quantity = 0;
+    dropEmptyHeadLots(lotQueue);
+
+    return quantityExpired;
+}
+
+/**
+ * @brief getOldestLotExpiry returns when the oldest stock held expires.
+ * @param lotQueue = Lot queue
+ * @return = Expiry time of the oldest lot, or LOT_NEVER_EXPIRES if the queue is empty
+ */
+
+std::int64_t getOldestLotExpiry(const ingredientLotQueue &lotQueue) {
+    return lotQueue.count > 0 ? lotQueue.lots[lotQueue.head].expiryTime : LOT_NEVER_EXPIRES;
+}
+
+/**
+ * @brief pushLotExpiry schedules a lot's expiry time.
+ * @param lotExpiries = Heap of expiry times passed by reference
+ * @param entry = Expiry to schedule
+ */
+
+void pushLotExpiry(std::vector<lotExpiryEntry> &lotExpiries, const lotExpiryEntry &entry) {
+    lotExpiries.push_back(entry);
+    std::push_heap(lotExpiries.begin(), lotExpiries.end(), isLaterLotExpiry);
+}
+
+/**
+ * @brief popDueLotExpiry removes the earliest scheduled expiry if it is due.
+ * @param lotExpiries = Heap of expiry times passed by reference
+ * @param currentTime = Current time in seconds since the epoch
+ * @param entry = Entry to receive the expiry passed by reference
+ * @return = Boolean indicating whether an expiry was due
+ */
+
+bool popDueLotExpiry(std::vector<lotExpiryEntry> &lotExpiries, std::int64_t currentTime, lotExpiryEntry &entry) {
+    if (lotExpiries.empty() || lotExpiries.front().expiryTime > currentTime) {
+        return false;
+    }
+
+    std::pop_heap(lotExpiries.begin(), lotExpiries.end(), isLaterLotExpiry);
+    entry = lotExpiries.back();
+    lotExpiries.pop_back();
+
+    return true;
+}
+
+/**
+ * @brief compactLotExpiries removes entries whose lot was used up, merged, or rescheduled, and rebuilds the heap.
+ * @param lotExpiries = Heap of expiry times passed by reference
+ * @param ingredientLots = Lot queue of each ingredient the entries refer to
+ */
+
+void compactLotExpiries(std::vector<lotExpiryEntry> &lotExpiries, const std::vector<ingredientLotQueue> &ingredientLots) {
+    std::vector<lotExpiryEntry>::size_type scheduledCount = 0;
+    for (std::vector<lotExpiryEntry>::size_type i = 0; i < lotExpiries.size(); ++i) {
+        if (isLotExpiryScheduled(ingredientLots, lotExpiries[i])) {
+            lotExpiries[scheduledCount++] = lotExpiries[i];
+        }
+    }
+    lotExpiries.resize(scheduledCount);
+    std::make_heap(lotExpiries.begin(), lotExpiries.end(), isLaterLotExpiry);
+}
+
+/**
+ * @brief dropEmptyHeadLots drops used up and expired lots from the front of the queue.
+ * @param lotQueue = Lot queue to update passed by reference
+ */
+
+static void dropEmptyHeadLots(ingredientLotQueue &lotQueue) {
+    while (lotQueue.count > 0 && lotQueue.lots[lotQueue.head].quantity == 0) {
+        lotQueue.head = (lotQueue.head + 1) % MAX_INGREDIENT_LOTS;
+        --lotQueue.count;
+        ++lotQueue.headSequence;
+    }
+}
+
+/**
+ * @brief isLotExpiryScheduled checks whether an expiry entry still refers to a lot held with that expiry time.
+ * @param ingredientLots = Lot queue of each ingredient
+ * @param entry = Expiry entry
+ * @return = Boolean indicating whether the entry can still expire stock
+ */
+
+static bool isLotExpiryScheduled(const std::vector<ingredientLotQueue> &ingredientLots, const lotExpiryEntry &entry) {
+    const ingredientLotQueue &lotQueue = ingredientLots[entry.ingredientIndex];
+    if (entry.lotSequence < lotQueue.headSequence || entry.lotSequence >= lotQueue.headSequence + lotQueue.count) {
+        return false;
+    }
+
+    const ingredientLot &lot = lotQueue.lots[(lotQueue.head + (entry.lotSequence - lotQueue.headSequence)) % MAX_INGREDIENT_LOTS];
+
+    return lot.quantity > 0 && lot.expiryTime == entry.expiryTime;
+}
+
+/**
+ * @brief isLaterLotExpiry orders the expiry heap so the earliest expiry is on top.
+ * @param firstEntry = First expiry
+ * @param secondEntry = Second expiry
+ * @return = Boolean indicating whether the first expiry is later than the second
+ */
+
+static bool isLaterLotExpiry(const lotExpiryEntry &firstEntry, const lotExpiryEntry &secondEntry) {
+    return firstEntry.expiryTime > secondEntry.expiryTime;
+}
@@ -0,0 +1,57 @@
+//================================================================================
+// Name        : ingredient_lots.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Stock of each ingredient kept as first-in, first-out lots with
+//               expiry times, and a heap of expiry times so sweeps only visit
+//               lots that are due
+//================================================================================
+
+#ifndef INGREDIENT_LOTS_H
+#define INGREDIENT_LOTS_H
+
+#include <cstdint>
+#include <vector>
+
+// Lots kept per ingredient. Restocking a full queue first merges its two oldest lots.
+const int MAX_INGREDIENT_LOTS = 16;
+
+// Expiry time of stock that never expires
+const std::int64_t LOT_NEVER_EXPIRES = INT64_MAX;
+
+// Quantity received in one restock and the time (seconds since the epoch) it expires.
+struct ingredientLot {
+    std::int64_t quantity;
+    std::int64_t expiryTime;
+};
+
+// Fixed-capacity ring of lots, oldest first. Each lot ever added gets the next sequence number; the oldest lot kept
+// has headSequence. Expired lots inside the ring are left with quantity 0 until they reach the head.
+struct ingredientLotQueue {
+    ingredientLot lots[MAX_INGREDIENT_LOTS];
+    std::uint32_t head;
+    std::uint32_t count;
+    std::uint64_t headSequence;
+};
+
+// Scheduled expiry of one lot. Entries whose lot was already used up or merged are skipped when popped, and dropped
+// when the heap is compacted.
+struct lotExpiryEntry {
+    std::int64_t expiryTime;
+    std::uint64_t lotSequence;
+    std::uint32_t ingredientIndex;
+};
+
+void clearIngredientLots(ingredientLotQueue &lotQueue);
+bool addIngredientLot(ingredientLotQueue &lotQueue, std::int64_t quantity, std::int64_t expiryTime, std::uint64_t &lotSequence);
+bool mergeOldestIngredientLots(ingredientLotQueue &lotQueue, std::uint64_t &lotSequence);
+void consumeIngredientLots(ingredientLotQueue &lotQueue, std::int64_t quantity);
+std::int64_t expireIngredientLot(ingredientLotQueue &lotQueue, std::uint64_t lotSequence, std::int64_t currentTime);
+std::int64_t getOldestLotExpiry(const ingredientLotQueue &lotQueue);
+
+void pushLotExpiry(std::vector<lotExpiryEntry> &lotExpiries, const lotExpiryEntry &entry);
+bool popDueLotExpiry(std::vector<lotExpiryEntry> &lotExpiries, std::int64_t currentTime, lotExpiryEntry &entry);
+void compactLotExpiries(std::vector<lotExpiryEntry> &lotExpiries, const std::vector<ingredientLotQueue> &ingredientLots);
+
+#endif // INGREDIENT_LOTS_H
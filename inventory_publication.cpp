@@ -0,0 +1,448 @@
+//================================================================================
+// Name        : inventory_publication.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Live inventory published to POSIX shared memory under a seqlock
+//               for kitchen displays and fleet monitors to poll
+//================================================================================
+
+#include "inventory_publication.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __unix__
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Most times a writer starts over when another writer removes or checks the name at the same moment.
+static const int MAX_PUBLICATION_CREATE_ATTEMPTS = 8;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared inventory fields must be lock-free to be read across processes.");
+
+static std::size_t getFieldsOffset(std::uint32_t ingredientCount, std::uint32_t itemCount);
+static bool isNamedSharedMemoryObject(int sharedMemoryDescriptor, const char *publicationName);
+static void setPublicationView(inventoryPublication &publication, void *mappedAddress, std::size_t mappedSize);
+
+/**
+ * @brief getInventoryPublicationName returns the shared memory object name to publish under or read from.
+ * @return = Name from INVENTORY_PUBLICATION_NAME_VARIABLE if set and beginning with '/', otherwise the default name
+ */
+
+const char *getInventoryPublicationName() {
+    const char *publicationName = std::getenv(INVENTORY_PUBLICATION_NAME_VARIABLE);
+
+    return publicationName != nullptr && publicationName[0] == '/' ? publicationName : DEFAULT_INVENTORY_PUBLICATION_NAME;
+}
+
+/**
+ * @brief createInventoryPublication creates the shared memory segment sized for a catalog, writes the catalog's codes
+ *        and labels, and maps it for writing. Fields start at zero. A segment already under the name is replaced only if
+ *        the writer that created it has stopped; the segment stays locked until it is closed or removed.
+ * @param publication = Publication view to receive the mapped segment passed by reference (unmapped on error)
+ * @param publicationName = Shared memory object name beginning with '/'
+ * @param catalog = Catalog whose inventory will be published
+ * @return = publicationError enum representing the result of creating the segment
+ */
+
+publicationError createInventoryPublication(inventoryPublication &publication, const char *publicationName, const truckCatalog &catalog) {
+    publication.lockDescriptor = -1;
+    setPublicationView(publication, nullptr, 0);
+
+#ifdef __unix__
+    std::uint32_t ingredientCount = static_cast<std::uint32_t>(catalog.ingredients.size());
+    std::uint32_t itemCount = static_cast<std::uint32_t>(catalog.items.size());
+    std::size_t mappedSize = getFieldsOffset(ingredientCount, itemCount) + (ingredientCount + itemCount + PUBLICATION_TRAILING_FIELD_COUNT) * sizeof(std::atomic<std::int64_t>);
+
+    // Create a new object under the name and lock it. A new object always starts empty, so readers still mapping an
+    // old segment under this name keep their own copy.
+    int sharedMemoryDescriptor = -1;
+    for (int attempt = 0; attempt < MAX_PUBLICATION_CREATE_ATTEMPTS && sharedMemoryDescriptor < 0; ++attempt) {
+        sharedMemoryDescriptor = shm_open(publicationName, O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (sharedMemoryDescriptor >= 0) {
+            // Another writer checking the name may hold the lock for a moment, and may remove the name before the
+            // lock is taken here. Either way, start over.
+            if (flock(sharedMemoryDescriptor, LOCK_EX | LOCK_NB) != 0 || !isNamedSharedMemoryObject(sharedMemoryDescriptor, publicationName)) {
+                close(sharedMemoryDescriptor);
+                sharedMemoryDescriptor = -1;
+            }
+            continue;
+        } else if (errno != EEXIST) {
+            return PUBLICATION_UNAVAILABLE;
+        }
+
+        // Name is taken. A writer still running holds the lock on its segment.
+        int existingDescriptor = shm_open(publicationName, O_RDWR, 0);
+        if (existingDescriptor < 0) {
+            continue;
+        }
+        if (flock(existingDescriptor, LOCK_EX | LOCK_NB) != 0) {
+            bool isLocked = errno == EWOULDBLOCK;
+            close(existingDescriptor);
+            return isLocked ? PUBLICATION_IN_USE : PUBLICATION_UNAVAILABLE;
+        }
+
+        // Writer stopped without removing its segment. Retire it for readers still mapping it, then remove the name.
+        if (isNamedSharedMemoryObject(existingDescriptor, publicationName)) {
+            struct stat existingStatus;
+            if (fstat(existingDescriptor, &existingStatus) == 0 && existingStatus.st_size >= static_cast<off_t>(sizeof(inventoryPublicationHeader))) {
+                void *existingAddress = mmap(nullptr, sizeof(inventoryPublicationHeader), PROT_READ | PROT_WRITE, MAP_SHARED, existingDescriptor, 0);
+                if (existingAddress != MAP_FAILED) {
+                    inventoryPublicationHeader *existingHeader = static_cast<inventoryPublicationHeader *>(existingAddress);
+                    if (existingHeader->magic == INVENTORY_PUBLICATION_MAGIC && existingHeader->version == INVENTORY_PUBLICATION_VERSION) {
+                        existingHeader->isRetired.store(1, std::memory_order_release);
+                    }
+                    munmap(existingAddress, sizeof(inventoryPublicationHeader));
+                }
+            }
+            shm_unlink(publicationName);
+        }
+        close(existingDescriptor);
+    }
+    if (sharedMemoryDescriptor < 0) {
+        return PUBLICATION_UNAVAILABLE;
+    }
+
+    if (ftruncate(sharedMemoryDescriptor, static_cast<off_t>(mappedSize)) != 0) {
+        shm_unlink(publicationName);
+        close(sharedMemoryDescriptor);
+        return PUBLICATION_UNAVAILABLE;
+    }
+
+    void *mappedAddress = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, sharedMemoryDescriptor, 0);
+    if (mappedAddress == MAP_FAILED) {
+        shm_unlink(publicationName);
+        close(sharedMemoryDescriptor);
+        return PUBLICATION_UNAVAILABLE;
+    }
+
+    // New objects are zero-filled, so only the header and names need writing. The magic goes last.
+    inventoryPublicationHeader *header = new (mappedAddress) inventoryPublicationHeader;
+    header->version = INVENTORY_PUBLICATION_VERSION;
+    header->ingredientCount = ingredientCount;
+    header->itemCount = itemCount;
+    header->isRetired.store(0, std::memory_order_relaxed);
+    header->sequence.store(0, std::memory_order_relaxed);
+
+    inventoryPublicationName *names = reinterpret_cast<inventoryPublicationName *>(static_cast<char *>(mappedAddress) + sizeof(inventoryPublicationHeader));
+    for (std::uint32_t i = 0; i < ingredientCount + itemCount; ++i) {
+        const std::string &code  = i < ingredientCount ? catalog.ingredients[i].code  : catalog.items[i - ingredientCount].code;
+        const std::string &label = i < ingredientCount ? catalog.ingredients[i].label : catalog.items[i - ingredientCount].label;
+        std::strncpy(names[i].code, code.c_str(), sizeof(names[i].code) - 1);
+        std::strncpy(names[i].label, label.c_str(), sizeof(names[i].label) - 1);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = INVENTORY_PUBLICATION_MAGIC;
+
+    publication.lockDescriptor = sharedMemoryDescriptor;
+    setPublicationView(publication, mappedAddress, mappedSize);
+
+    return PUBLICATION_SUCCESS;
+#else
+    (void)publicationName;
+    (void)catalog;
+
+    return PUBLICATION_UNAVAILABLE;
+#endif
+}
+
+/**
+ * @brief openInventoryPublication maps an existing shared memory segment read-only.
+ * @param publication = Publication view to receive the mapped segment passed by reference (unmapped on error)
+ * @param publicationName = Shared memory object name beginning with '/'
+ * @return = publicationError enum representing the result of opening the segment
+ */
+
+publicationError openInventoryPublication(inventoryPublication &publication, const char *publicationName) {
+    publication.lockDescriptor = -1;
+    setPublicationView(publication, nullptr, 0);
+
+#ifdef __unix__
+    int sharedMemoryDescriptor = shm_open(publicationName, O_RDONLY, 0);
+    if (sharedMemoryDescriptor < 0) {
+        return PUBLICATION_UNAVAILABLE;
+    }
+
+    // Reject segments too small to hold the header or their own fields before trusting the counts.
+    struct stat sharedMemoryStatus;
+    if (fstat(sharedMemoryDescriptor, &sharedMemoryStatus) != 0 || sharedMemoryStatus.st_size < static_cast<off_t>(sizeof(inventoryPublicationHeader))) {
+        close(sharedMemoryDescriptor);
+        return PUBLICATION_INCOMPATIBLE;
+    }
+
+    std::size_t mappedSize = static_cast<std::size_t>(sharedMemoryStatus.st_size);
+    void *mappedAddress = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, sharedMemoryDescriptor, 0);
+    close(sharedMemoryDescriptor);
+    if (mappedAddress == MAP_FAILED) {
+        return PUBLICATION_UNAVAILABLE;
+    }
+
+    const inventoryPublicationHeader *header = static_cast<const inventoryPublicationHeader *>(mappedAddress);
+    if (header->magic != INVENTORY_PUBLICATION_MAGIC || header->version != INVENTORY_PUBLICATION_VERSION) {
+        munmap(mappedAddress, mappedSize);
+        return PUBLICATION_INCOMPATIBLE;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (getFieldsOffset(header->ingredientCount, header->itemCount) + (static_cast<std::size_t>(header->ingredientCount) + header->itemCount + PUBLICATION_TRAILING_FIELD_COUNT) * sizeof(std::atomic<std::int64_t>) > mappedSize) {
+        munmap(mappedAddress, mappedSize);
+        return PUBLICATION_INCOMPATIBLE;
+    }
+
+    setPublicationView(publication, mappedAddress, mappedSize);
+
+    return PUBLICATION_SUCCESS;
+#else
+    (void)publicationName;
+
+    return PUBLICATION_UNAVAILABLE;
+#endif
+}
+
+/**
+ * @brief closeInventoryPublication unmaps a segment without removing it, and releases the writer's lock on it.
+ * @param publication = Publication view passed by reference (may be unmapped)
+ */
+
+void closeInventoryPublication(inventoryPublication &publication) {
+#ifdef __unix__
+    if (publication.mappedAddress != nullptr) {
+        munmap(publication.mappedAddress, publication.mappedSize);
+    }
+    if (publication.lockDescriptor >= 0) {
+        close(publication.lockDescriptor);
+    }
+#endif
+    publication.lockDescriptor = -1;
+    setPublicationView(publication, nullptr, 0);
+}
+
+/**
+ * @brief removeInventoryPublication retires the writer's segment, removes its name, and unmaps it, so readers know to
+ *        reopen or stop.
+ * @param publication = Publication view passed by reference (may be unmapped)
+ * @param publicationName = Shared memory object name beginning with '/'
+ */
+
+void removeInventoryPublication(inventoryPublication &publication, const char *publicationName) {
+    if (publication.header == nullptr) {
+        return;
+    }
+
+    publication.header->isRetired.store(1, std::memory_order_release);
+#ifdef __unix__
+    shm_unlink(publicationName);
+#else
+    (void)publicationName;
+#endif
+    closeInventoryPublication(publication);
+}
+
+/**
+ * @brief isInventoryPublicationRetired determines if the writer has replaced or removed a segment.
+ * @param publication = Publication view
+ * @return = Boolean indicating whether the segment is retired
+ */
+
+bool isInventoryPublicationRetired(const inventoryPublication &publication) {
+    return publication.header->isRetired.load(std::memory_order_acquire) != 0;
+}
+
+/**
+ * @brief isInventoryPublicationForCatalog determines if a segment is laid out for a catalog, with the same ingredients
+ *        and items in the same order under the same codes and labels, so the catalog's inventory can be published into
+ *        it without replacing it.
+ * @param publication = Publication view (may be unmapped)
+ * @param catalog = Catalog to compare
+ * @return = Boolean indicating whether the segment matches the catalog
+ */
+
+bool isInventoryPublicationForCatalog(const inventoryPublication &publication, const truckCatalog &catalog) {
+    if (publication.header == nullptr || publication.header->ingredientCount != catalog.ingredients.size() || publication.header->itemCount != catalog.items.size()) {
+        return false;
+    }
+
+    std::uint32_t ingredientCount = publication.header->ingredientCount;
+    for (std::uint32_t i = 0; i < ingredientCount + publication.header->itemCount; ++i) {
+        const std::string &code  = i < ingredientCount ? catalog.ingredients[i].code  : catalog.items[i - ingredientCount].code;
+        const std::string &label = i < ingredientCount ? catalog.ingredients[i].label : catalog.items[i - ingredientCount].label;
+        if (std::strncmp(publication.names[i].code, code.c_str(), sizeof(publication.names[i].code) - 1) != 0 || std::strncmp(publication.names[i].label, label.c_str(), sizeof(publication.names[i].label) - 1) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief beginInventoryPublication marks an update in progress. Must only be called by the single writer.
+ * @param publication = Mapped publication view passed by reference
+ */
+
+void beginInventoryPublication(inventoryPublication &publication) {
+    std::uint64_t sequence = publication.header->sequence.load(std::memory_order_relaxed);
+    publication.header->sequence.store(sequence + 1, std::memory_order_relaxed);
+
+    // The fence keeps field stores from becoming visible before the odd sequence.
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * @brief publishInventoryField stores one field during an update.
+ * @param publication = Mapped publication view passed by reference
+ * @param fieldIndex = Index of field (ingredients, then items, then publicationTrailingField)
+ * @param value = Value to store
+ */
+
+void publishInventoryField(inventoryPublication &publication, std::uint32_t fieldIndex, std::int64_t value) {
+    publication.fields[fieldIndex].store(value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief endInventoryPublication stores the publication count and marks the update complete.
+ * @param publication = Mapped publication view passed by reference
+ */
+
+void endInventoryPublication(inventoryPublication &publication) {
+    std::uint64_t sequence = publication.header->sequence.load(std::memory_order_relaxed);
+    publication.fields[publication.fieldCount - PUBLICATION_TRAILING_FIELD_COUNT + PUBLICATION_COUNT].store(static_cast<std::int64_t>(sequence / 2 + 1), std::memory_order_relaxed);
+    publication.header->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+/**
+ * @brief readInventoryPublication copies a consistent set of fields out of the segment, retrying while the writer is
+ *        mid-update. Gives up if one update stays in progress for PUBLICATION_STALL_MILLISECONDS, which means the writer
+ *        stopped partway through it.
+ * @param publication = Mapped publication view
+ * @param fieldValues = Array of publication.fieldCount values to receive fields
+ * @param retryCount = Unsigned integer to receive number of retries needed passed by reference (0 when the first attempt
+ *                     was consistent)
+ * @return = publicationError enum representing the result of reading the segment
+ */
+
+publicationError readInventoryPublication(const inventoryPublication &publication, std::int64_t *fieldValues, unsigned int &retryCount) {
+    retryCount = 0;
+
+    // Odd sequence seen on consecutive attempts and when it was first seen. The clock is only read while it repeats.
+    std::uint64_t stalledSequence = 0;
+    std::chrono::steady_clock::time_point stallStart;
+
+    for (;;) {
+        std::uint64_t sequenceBefore = publication.header->sequence.load(std::memory_order_acquire);
+        if ((sequenceBefore & 1) == 0) {
+            for (std::uint32_t i = 0; i < publication.fieldCount; ++i) {
+                fieldValues[i] = publication.fields[i].load(std::memory_order_relaxed);
+            }
+
+            // The fence keeps field loads from moving after the second sequence load.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (publication.header->sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+                return PUBLICATION_SUCCESS;
+            }
+        } else if (sequenceBefore != stalledSequence) {
+            stalledSequence = sequenceBefore;
+            stallStart = std::chrono::steady_clock::now();
+        } else if (retryCount % 1024 == 0 && std::chrono::steady_clock::now() - stallStart > std::chrono::milliseconds(PUBLICATION_STALL_MILLISECONDS)) {
+            return PUBLICATION_STALLED;
+        }
+
+        ++retryCount;
+    }
+}
+
+/**
+ * @brief publishCatalogInventory publishes ingredient inventories and item availability that changed since the
+ *        inventory's changes were last cleared, along with revenue.
+ * @param publication = Publication view passed by reference (does nothing if unmapped)
+ * @param inventory = Inventory of the catalog the segment was created for
+ * @param salesRevenueCents = Revenue from items sold so far in cents, before tax
+ */
+
+void publishCatalogInventory(inventoryPublication &publication, const catalogInventory &inventory, std::int64_t salesRevenueCents) {
+    if (publication.header == nullptr) {
+        return;
+    }
+
+    std::uint32_t ingredientCount = publication.header->ingredientCount;
+
+    beginInventoryPublication(publication);
+    for (std::uint32_t i = 0; i < inventory.changedIngredients.size(); ++i) {
+        publishInventoryField(publication, inventory.changedIngredients[i], inventory.ingredientInventories[inventory.changedIngredients[i]]);
+    }
+    for (std::uint32_t i = 0; i < inventory.changedItems.size(); ++i) {
+        publishInventoryField(publication, ingredientCount + inventory.changedItems[i], inventory.itemAvailability[inventory.changedItems[i]]);
+    }
+    publishInventoryField(publication, publication.fieldCount - PUBLICATION_TRAILING_FIELD_COUNT + PUBLICATION_REVENUE_CENTS, salesRevenueCents);
+    endInventoryPublication(publication);
+}
+
+/**
+ * @brief getFieldsOffset calculates where fields start, after the header and names, on a cache line boundary.
+ * @param ingredientCount = Number of ingredients
+ * @param itemCount = Number of items
+ * @return = Offset of fields in bytes
+ */
+
+static std::size_t getFieldsOffset(std::uint32_t ingredientCount, std::uint32_t itemCount) {
+    std::size_t namesEnd = sizeof(inventoryPublicationHeader) + (static_cast<std::size_t>(ingredientCount) + itemCount) * sizeof(inventoryPublicationName);
+
+    return (namesEnd + 63) / 64 * 64;
+}
+
+#ifdef __unix__
+/**
+ * @brief isNamedSharedMemoryObject determines if a shared memory object name still refers to an open object, so a name
+ *        removed and reused by another writer is never mistaken for it.
+ * @param sharedMemoryDescriptor = Descriptor of the open object
+ * @param publicationName = Shared memory object name beginning with '/'
+ * @return = Boolean indicating whether the name refers to the object
+ */
+
+static bool isNamedSharedMemoryObject(int sharedMemoryDescriptor, const char *publicationName) {
+    int namedDescriptor = shm_open(publicationName, O_RDONLY, 0);
+    if (namedDescriptor < 0) {
+        return false;
+    }
+
+    struct stat openStatus;
+    struct stat namedStatus;
+    bool isSameObject = fstat(sharedMemoryDescriptor, &openStatus) == 0 && fstat(namedDescriptor, &namedStatus) == 0 && openStatus.st_dev == namedStatus.st_dev && openStatus.st_ino == namedStatus.st_ino;
+    close(namedDescriptor);
+
+    return isSameObject;
+}
+#endif
+
+/**
+ * @brief setPublicationView points a publication view at a mapped segment, or clears it.
+ * @param publication = Publication view passed by reference
+ * @param mappedAddress = Start of mapped segment (nullptr to clear)
+ * @param mappedSize = Size of mapped segment
+ */
+
+static void setPublicationView(inventoryPublication &publication, void *mappedAddress, std::size_t mappedSize) {
+    publication.mappedAddress = mappedAddress;
+    publication.mappedSize = mappedSize;
+
+    if (mappedAddress == nullptr) {
+        publication.header = nullptr;
+        publication.names = nullptr;
+        publication.fields = nullptr;
+        publication.fieldCount = 0;
+        return;
+    }
+
+    char *segmentStart = static_cast<char *>(mappedAddress);
+    publication.header = reinterpret_cast<inventoryPublicationHeader *>(segmentStart);
+    publication.names = reinterpret_cast<const inventoryPublicationName *>(segmentStart + sizeof(inventoryPublicationHeader));
+    publication.fields = reinterpret_cast<std::atomic<std::int64_t> *>(segmentStart + getFieldsOffset(publication.header->ingredientCount, publication.header->itemCount));
+    publication.fieldCount = publication.header->ingredientCount + publication.header->itemCount + PUBLICATION_TRAILING_FIELD_COUNT;
+}
@@ -0,0 +1,84 @@
+//================================================================================
+// Name        : inventory_publication.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Live inventory published to POSIX shared memory under a seqlock
+//               for kitchen displays and fleet monitors to poll
+//================================================================================
+
+#ifndef INVENTORY_PUBLICATION_H
+#define INVENTORY_PUBLICATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "catalog.h"
+
+// Shared memory object name used by the program and the inventory reader, and the environment variable that replaces
+// it (so a test run can publish without touching a live truck's segment).
+#define DEFAULT_INVENTORY_PUBLICATION_NAME "/rebel_food_truck_inventory"
+#define INVENTORY_PUBLICATION_NAME_VARIABLE "REBEL_FOOD_TRUCK_PUBLICATION"
+
+// Identifies a segment and its layout so readers never interpret a foreign or outdated segment.
+const std::uint32_t INVENTORY_PUBLICATION_MAGIC   = 0x52465449; // "RFTI"
+const std::uint32_t INVENTORY_PUBLICATION_VERSION = 2;
+
+// Longest label kept in the segment, including the terminating null character.
+const int PUBLICATION_LABEL_SIZE = 48;
+
+// Longest time a reader waits on an update in progress before deciding the writer stopped mid-update.
+const int PUBLICATION_STALL_MILLISECONDS = 1000;
+
+enum publicationError { PUBLICATION_SUCCESS, PUBLICATION_UNAVAILABLE, PUBLICATION_INCOMPATIBLE, PUBLICATION_IN_USE, PUBLICATION_STALLED };
+
+// Start of the shared segment. Names are written once when the segment is created. The sequence is odd while the
+// single writer is updating fields, so readers copy fields and retry if the sequence was odd or changed; they never
+// block the writer or make a system call. A segment is retired when the catalog changes and a new one replaces it.
+struct inventoryPublicationHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t ingredientCount;
+    std::uint32_t itemCount;
+    std::atomic<std::uint32_t> isRetired;
+    alignas(64) std::atomic<std::uint64_t> sequence;
+};
+
+// Code and label of one ingredient or item, ingredients first.
+struct inventoryPublicationName {
+    char code[MAX_CATALOG_CODE_LENGTH + 1];
+    char label[PUBLICATION_LABEL_SIZE];
+};
+
+// Fields following the names: ingredient inventories, then item availability, then these.
+enum publicationTrailingField { PUBLICATION_REVENUE_CENTS, PUBLICATION_COUNT, PUBLICATION_TRAILING_FIELD_COUNT };
+
+// Process-local view of a mapped segment. The writer keeps its segment open and locked for as long as it publishes, so
+// another writer can tell a live segment from one left behind by a crash.
+struct inventoryPublication {
+    int lockDescriptor;
+    void *mappedAddress;
+    std::size_t mappedSize;
+    inventoryPublicationHeader *header;
+    const inventoryPublicationName *names;
+    std::atomic<std::int64_t> *fields;
+    std::uint32_t fieldCount;
+};
+
+const char *getInventoryPublicationName();
+publicationError createInventoryPublication(inventoryPublication &publication, const char *publicationName, const truckCatalog &catalog);
+publicationError openInventoryPublication(inventoryPublication &publication, const char *publicationName);
+void closeInventoryPublication(inventoryPublication &publication);
+void removeInventoryPublication(inventoryPublication &publication, const char *publicationName);
+bool isInventoryPublicationRetired(const inventoryPublication &publication);
+bool isInventoryPublicationForCatalog(const inventoryPublication &publication, const truckCatalog &catalog);
+
+void beginInventoryPublication(inventoryPublication &publication);
+void publishInventoryField(inventoryPublication &publication, std::uint32_t fieldIndex, std::int64_t value);
+void endInventoryPublication(inventoryPublication &publication);
+publicationError readInventoryPublication(const inventoryPublication &publication, std::int64_t *fieldValues, unsigned int &retryCount);
+
+void publishCatalogInventory(inventoryPublication &publication, const catalogInventory &inventory, std::int64_t salesRevenueCents);
+
+#endif // INVENTORY_PUBLICATION_H
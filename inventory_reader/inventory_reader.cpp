@@ -0,0 +1,263 @@
+//================================================================================
+// Name        : inventory_reader.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Reads the live inventory published by the Rebel Food Truck
+//               Inventory Sales Program and benchmarks seqlock contention
+//================================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "inventory_publication.h"
+
+// Shared memory object name used only by the benchmark so it never disturbs a running program.
+#define BENCHMARK_PUBLICATION_NAME "/rebel_food_truck_inventory_benchmark"
+
+void printInventoryPublication(const inventoryPublication &publication, const std::int64_t *fieldValues);
+int watchInventory(inventoryPublication &publication, int pollIntervalMicroseconds);
+int benchmarkInventoryPublication(double benchmarkSeconds, int readerCount, int catalogSize);
+
+int main(int argc, char *argv[]) {
+    // Determine mode selected.
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        double benchmarkSeconds = argc > 2 ? std::atof(argv[2]) : 2.0;
+        int readerCount = argc > 3 ? std::atoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency()) - 1;
+        int catalogSize = argc > 4 ? std::atoi(argv[4]) : 5;
+        if (argc <= 3 && readerCount < 1) {
+            readerCount = 1;
+        }
+        if (benchmarkSeconds <= 0 || readerCount < 1 || catalogSize < 1) {
+            std::cerr << "Usage: " << argv[0] << " --benchmark [seconds] [readers] [items]" << std::endl;
+            return 1;
+        }
+        return benchmarkInventoryPublication(benchmarkSeconds, readerCount, catalogSize);
+    } else if (argc > 1 && std::strcmp(argv[1], "--watch") != 0) {
+        std::cerr << "Usage: " << argv[0] << " [--watch [interval_us] | --benchmark [seconds] [readers] [items]]" << std::endl;
+        return 1;
+    }
+
+    // Open program's segment.
+    inventoryPublication publication;
+    publicationError errorResult = openInventoryPublication(publication, getInventoryPublicationName());
+    if (errorResult == PUBLICATION_UNAVAILABLE) {
+        std::cerr << "No inventory is being published. Is the program running?" << std::endl;
+        return 1;
+    } else if (errorResult == PUBLICATION_INCOMPATIBLE) {
+        std::cerr << "Published inventory has an incompatible layout." << std::endl;
+        return 1;
+    }
+
+    int exitStatus = 0;
+    if (argc > 1) {
+        exitStatus = watchInventory(publication, argc > 2 ? std::atoi(argv[2]) : 100000);
+    } else {
+        std::vector<std::int64_t> fieldValues(publication.fieldCount);
+        unsigned int retryCount = 0;
+        if (readInventoryPublication(publication, fieldValues.data(), retryCount) == PUBLICATION_SUCCESS) {
+            printInventoryPublication(publication, fieldValues.data());
+        } else {
+            std::cerr << "Published inventory is stuck mid-update. Did the program stop?" << std::endl;
+            exitStatus = 1;
+        }
+    }
+
+    closeInventoryPublication(publication);
+
+    return exitStatus;
+}
+
+/**
+ * @brief printInventoryPublication prints published ingredient inventories and item availability as aligned tables.
+ * @param publication = Mapped publication view
+ * @param fieldValues = Fields copied from the publication
+ */
+
+void printInventoryPublication(const inventoryPublication &publication, const std::int64_t *fieldValues) {
+    std::uint32_t ingredientCount = publication.header->ingredientCount;
+    std::uint32_t itemCount = publication.header->itemCount;
+    const std::int64_t *trailingFields = fieldValues + ingredientCount + itemCount;
+
+    std::stringstream publicationOSS;
+    publicationOSS << std::left << std::setw(MAX_CATALOG_CODE_LENGTH + 2) << "Code" << std::setw(PUBLICATION_LABEL_SIZE) << "Ingredient" << "Current Inventory" << std::endl;
+    for (std::uint32_t i = 0; i < ingredientCount; ++i) {
+        publicationOSS << std::setw(MAX_CATALOG_CODE_LENGTH + 2) << publication.names[i].code << std::setw(PUBLICATION_LABEL_SIZE) << publication.names[i].label << fieldValues[i] << std::endl;
+    }
+    publicationOSS << std::endl << std::setw(MAX_CATALOG_CODE_LENGTH + 2) << "Code" << std::setw(PUBLICATION_LABEL_SIZE) << "Item" << "Quantity Available" << std::endl;
+    for (std::uint32_t i = ingredientCount; i < ingredientCount + itemCount; ++i) {
+        publicationOSS << std::setw(MAX_CATALOG_CODE_LENGTH + 2) << publication.names[i].code << std::setw(PUBLICATION_LABEL_SIZE) << publication.names[i].label << fieldValues[i] << std::endl;
+    }
+    std::int64_t revenueCents = trailingFields[PUBLICATION_REVENUE_CENTS];
+    publicationOSS << std::endl
+                   << "Revenue: $ " << revenueCents / 100 << "." << std::right << std::setfill('0') << std::setw(2) << revenueCents % 100 << std::setfill(' ') << std::endl
+                   << "Publication: " << trailingFields[PUBLICATION_COUNT] << std::endl;
+    std::cout << publicationOSS.str() << std::flush;
+}
+
+/**
+ * @brief watchInventory polls the segment and prints each new publication. Follows the program to a new segment when
+ *        its catalog changes, and stops when the program quits.
+ * @param publication = Mapped publication view passed by reference
+ * @param pollIntervalMicroseconds = Time to sleep between polls (0 to spin)
+ * @return = Integer exit status
+ */
+
+int watchInventory(inventoryPublication &publication, int pollIntervalMicroseconds) {
+    std::vector<std::int64_t> fieldValues(publication.fieldCount);
+    std::int64_t lastPublicationCount = -1;
+    unsigned int retryCount = 0;
+
+    for (;;) {
+        // Reopen a retired segment. The program removes the name when it quits.
+        if (isInventoryPublicationRetired(publication)) {
+            closeInventoryPublication(publication);
+            if (openInventoryPublication(publication, getInventoryPublicationName()) != PUBLICATION_SUCCESS) {
+                std::cout << std::endl << "Inventory is no longer being published." << std::endl;
+                return 0;
+            }
+            fieldValues.assign(publication.fieldCount, 0);
+            lastPublicationCount = -1;
+        }
+
+        if (readInventoryPublication(publication, fieldValues.data(), retryCount) != PUBLICATION_SUCCESS) {
+            std::cerr << std::endl << "Published inventory is stuck mid-update. Did the program stop?" << std::endl;
+            return 1;
+        }
+
+        std::int64_t publicationCount = fieldValues[publication.fieldCount - PUBLICATION_TRAILING_FIELD_COUNT + PUBLICATION_COUNT];
+        if (publicationCount != lastPublicationCount) {
+            lastPublicationCount = publicationCount;
+            std::cout << std::endl;
+            printInventoryPublication(publication, fieldValues.data());
+        }
+
+        if (pollIntervalMicroseconds > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(pollIntervalMicroseconds));
+        }
+    }
+}
+
+/**
+ * @brief runPublicationBenchmark publishes every field as fast as possible for a fixed time while readerCount threads
+ *        poll.
+ * @param publication = Mapped benchmark publication view passed by reference
+ * @param benchmarkSeconds = Duration of the run
+ * @param readerCount = Number of polling reader threads
+ * @param writeCount = Unsigned long long to receive number of publications passed by reference
+ * @param readCount = Unsigned long long to receive number of consistent reads passed by reference
+ * @param retryCount = Unsigned long long to receive number of read retries passed by reference
+ * @param tornReadCount = Unsigned long long to receive number of inconsistent reads returned passed by reference
+ */
+
+static void runPublicationBenchmark(inventoryPublication &publication, double benchmarkSeconds, int readerCount, unsigned long long &writeCount, unsigned long long &readCount, unsigned long long &retryCount, unsigned long long &tornReadCount) {
+    std::atomic<bool> isRunning(true);
+    std::vector<unsigned long long> readerReads(readerCount, 0);
+    std::vector<unsigned long long> readerRetries(readerCount, 0);
+    std::vector<unsigned long long> readerTornReads(readerCount, 0);
+    std::vector<std::thread> readers;
+    std::uint32_t publishedFieldCount = publication.fieldCount - PUBLICATION_TRAILING_FIELD_COUNT + PUBLICATION_COUNT;
+
+    for (int i = 0; i < readerCount; ++i) {
+        readers.push_back(std::thread([&, i]() {
+            unsigned long long reads = 0;
+            unsigned long long retries = 0;
+            unsigned long long tornReads = 0;
+            unsigned int readRetries = 0;
+            std::vector<std::int64_t> fieldValues(publication.fieldCount);
+            while (isRunning.load(std::memory_order_relaxed)) {
+                readInventoryPublication(publication, fieldValues.data(), readRetries);
+                retries += readRetries;
+                ++reads;
+
+                // Every field of a benchmark publication holds the same value, so a mix means a torn read.
+                for (std::uint32_t j = 1; j < publishedFieldCount; ++j) {
+                    if (fieldValues[j] != fieldValues[0]) {
+                        ++tornReads;
+                        break;
+                    }
+                }
+            }
+            readerReads[i] = reads;
+            readerRetries[i] = retries;
+            readerTornReads[i] = tornReads;
+        }));
+    }
+
+    // Writer runs on this thread.
+    writeCount = 0;
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(benchmarkSeconds));
+    while (std::chrono::steady_clock::now() < endTime) {
+        for (int batch = 0; batch < 1024; ++batch) {
+            ++writeCount;
+            beginInventoryPublication(publication);
+            for (std::uint32_t j = 0; j < publishedFieldCount; ++j) {
+                publishInventoryField(publication, j, static_cast<std::int64_t>(writeCount));
+            }
+            endInventoryPublication(publication);
+        }
+    }
+    isRunning.store(false);
+
+    readCount = 0;
+    retryCount = 0;
+    tornReadCount = 0;
+    for (int i = 0; i < readerCount; ++i) {
+        readers[i].join();
+        readCount += readerReads[i];
+        retryCount += readerRetries[i];
+        tornReadCount += readerTornReads[i];
+    }
+}
+
+/**
+ * @brief benchmarkInventoryPublication measures writer throughput alone and with polling readers, and reader throughput.
+ * @param benchmarkSeconds = Duration of each run
+ * @param readerCount = Number of polling reader threads in the contended run
+ * @param catalogSize = Number of ingredients and of items in the benchmark segment
+ * @return = Integer exit status (nonzero if segment is unavailable or a torn read was observed)
+ */
+
+int benchmarkInventoryPublication(double benchmarkSeconds, int readerCount, int catalogSize) {
+    // Catalog with one ingredient per item
+    truckCatalog catalog;
+    clearCatalog(catalog);
+    for (int i = 0; i < catalogSize; ++i) {
+        std::string code = "I" + std::to_string(i);
+        addCatalogIngredient(catalog, code, code, code, "", 100);
+        addCatalogItem(catalog, code, code, code, 1.0, (code + ":1").c_str());
+    }
+    finalizeCatalog(catalog, 0.2);
+
+    inventoryPublication publication;
+    if (createInventoryPublication(publication, BENCHMARK_PUBLICATION_NAME, catalog) != PUBLICATION_SUCCESS) {
+        std::cerr << "Could not create benchmark shared memory segment." << std::endl;
+        return 1;
+    }
+
+    unsigned long long soloWrites, soloReads, soloRetries, soloTornReads;
+    unsigned long long writes, reads, retries, tornReads;
+    runPublicationBenchmark(publication, benchmarkSeconds, 0, soloWrites, soloReads, soloRetries, soloTornReads);
+    runPublicationBenchmark(publication, benchmarkSeconds, readerCount, writes, reads, retries, tornReads);
+
+    removeInventoryPublication(publication, BENCHMARK_PUBLICATION_NAME);
+
+    std::stringstream resultOSS;
+    resultOSS << std::fixed << std::setprecision(2)
+              << "Fields per publication: " << 2 * catalogSize + 1 << std::endl
+              << "Writer alone:           " << soloWrites / benchmarkSeconds / 1e6 << " M publications/s" << std::endl
+              << "Writer with " << std::setw(2) << readerCount << " readers:  " << writes / benchmarkSeconds / 1e6 << " M publications/s (" << (soloWrites > 0 ? 100.0 * writes / soloWrites : 0.0) << "% of alone)" << std::endl
+              << "Readers:                " << reads / benchmarkSeconds / 1e6 << " M reads/s total, " << reads / benchmarkSeconds / readerCount / 1e6 << " M reads/s each" << std::endl
+              << "Read retries:           " << (reads > 0 ? 100.0 * retries / reads : 0.0) << "% of reads" << std::endl
+              << "Torn reads:             " << tornReads << std::endl;
+    std::cout << resultOSS.str();
+
+    return tornReads == 0 ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+QT -= gui core
+
+CONFIG += c++11 console thread
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ..
+
+SOURCES += \
+    inventory_reader.cpp \
+    ../catalog.cpp \
+    ../ingredient_lots.cpp \
+    ../inventory_publication.cpp
+
+HEADERS += \
+    ../catalog.h \
+    ../ingredient_lots.h \
+    ../inventory_publication.h
+
+unix:!macx: LIBS += -lrt
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
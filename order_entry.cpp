@@ -0,0 +1,359 @@
+//================================================================================
+// Name        : order_entry.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Whole customer orders entered on a single line, such as
+//               "0x3 1x2 4x1", parsed and checked against inventory at once
+//================================================================================
+
+#include "order_entry.h"
+
+#include <cctype>
+
+// Largest quantity accepted for one item on an order line. Keeps totals far from integer overflow.
+static const std::int64_t MAX_ORDER_LINE_QUANTITY = 1000000;
+
+static bool isOrderSeparator(char character);
+static const char *skipOrderBlanks(const char *character);
+static const char *findOrderWordEnd(const char *wordStart);
+static bool isOrderQuantity(const char *quantityStart, const char *quantityEnd);
+static const char *findQuantitySeparator(const char *tokenStart, const char *tokenEnd);
+static std::int32_t findOrderItem(const char *itemStart, const char *itemEnd, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount);
+static bool isQuantityMarker(char character);
+
+/**
+ * @brief isOrderLine determines if input is an order line rather than a single sell menu option: some 'x' in it follows
+ *        a complete item code or option number, directly or after blanks. Codes may contain 'x' too, so look up a whole
+ *        item code first.
+ * @param stringInputPointer = Null-terminated byte string constant of input
+ * @param catalog = Catalog to look up item codes in
+ * @param pageItems = Item indexes for each option number on the page shown
+ * @param pageItemCount = Number of options on the page shown
+ * @return = Boolean indicating whether input contains an item/quantity separator
+ */
+
+bool isOrderLine(const char *stringInputPointer, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount) {
+    const char *wordStart = stringInputPointer;
+    for (;;) {
+        while (isOrderSeparator(*wordStart)) {
+            ++wordStart;
+        }
+        if (*wordStart == '\0') {
+            return false;
+        }
+
+        // "BURGERx3" or "BURGER x3"
+        const char *wordEnd = findOrderWordEnd(wordStart);
+        const char *separator = findQuantitySeparator(wordStart, wordEnd);
+        if (separator != nullptr && findOrderItem(wordStart, separator, catalog, pageItems, pageItemCount) >= 0) {
+            return true;
+        } else if (isQuantityMarker(*skipOrderBlanks(wordEnd)) && findOrderItem(wordStart, wordEnd, catalog, pageItems, pageItemCount) >= 0) {
+            return true;
+        }
+        wordStart = wordEnd;
+    }
+}
+
+/**
+ * @brief parseOrderLine parses "item x quantity" pairs separated by spaces or commas in one pass without allocating.
+ *        Blanks around the 'x' are allowed ("BURGERx3", "BURGER x3", and "BURGER x 3" are the same pair). An item is an
+ *        option number from the sell table page shown or an item code. A whole word that is an item is tried before an
+ *        'x' inside it, so a code such as "BOX2" stays whole in "BOX2 x3". Repeated items are added together.
+ * @param order = Order line to receive items and quantities passed by reference
+ * @param stringInputPointer = Null-terminated byte string constant of input
+ * @param catalog = Catalog to look up item codes in
+ * @param pageItems = Item indexes for each option number on the page shown
+ * @param pageItemCount = Number of options on the page shown
+ * @return = orderEntryError enum representing the result of parsing the order line
+ */
+
+orderEntryError parseOrderLine(orderLine &order, const char *stringInputPointer, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount) {
+    order.itemCount = 0;
+    order.ingredientCount = 0;
+
+    const char *character = stringInputPointer;
+    for (;;) {
+        // Skip separators.
+        while (isOrderSeparator(*character)) {
+            ++character;
+        }
+        if (*character == '\0') {
+            break;
+        }
+
+        // Find pair boundaries. Blanks may surround the 'x', as in "BURGER x3" or "0 x 3".
+        const char *itemStart = character;
+        const char *wordEnd = findOrderWordEnd(itemStart);
+        const char *nextWordStart = skipOrderBlanks(wordEnd);
+        const char *nextWordEnd = findOrderWordEnd(nextWordStart);
+        const char *separator = findQuantitySeparator(itemStart, wordEnd);
+        std::int32_t itemIndex = findOrderItem(itemStart, wordEnd, catalog, pageItems, pageItemCount);
+        const char *quantityStart = nullptr;
+        if ((itemIndex >= 0 || separator == nullptr) && isQuantityMarker(*nextWordStart)) {
+            // "BURGER x3" or "BURGER x 3"
+            quantityStart = nextWordStart + 1;
+            character = nextWordEnd;
+            if (quantityStart == character) {
+                quantityStart = skipOrderBlanks(character);
+                character = findOrderWordEnd(quantityStart);
+            }
+        } else if (separator != nullptr) {
+            // "BURGERx3", or "BURGERx 3"
+            itemIndex = findOrderItem(itemStart, separator, catalog, pageItems, pageItemCount);
+            quantityStart = separator + 1;
+            character = wordEnd;
+            if (quantityStart == character) {
+                quantityStart = nextWordStart;
+                character = nextWordEnd;
+            }
+        } else {
+            return ORDER_INVALID_SYNTAX;
+        }
+        if (!isOrderQuantity(quantityStart, character)) {
+            return ORDER_INVALID_SYNTAX;
+        } else if (itemIndex < 0) {
+            return ORDER_UNKNOWN_ITEM;
+        }
+
+        // Quantity (digits only, as checked above)
+        std::int64_t quantity = 0;
+        for (const char *digit = quantityStart; digit < character; ++digit) {
+            if (quantity <= MAX_ORDER_LINE_QUANTITY) {
+                quantity = quantity * 10 + (*digit - '0');
+            }
+        }
+
+        // Add to existing item or a new one.
+        int orderItem = 0;
+        while (orderItem < order.itemCount && order.itemIndexes[orderItem] != static_cast<std::uint32_t>(itemIndex)) {
+            ++orderItem;
+        }
+        if (orderItem == order.itemCount) {
+            if (order.itemCount == MAX_ORDER_LINE_ITEMS) {
+                return ORDER_TOO_MANY_ITEMS;
+            }
+            order.itemIndexes[orderItem] = static_cast<std::uint32_t>(itemIndex);
+            order.itemQuantities[orderItem] = 0;
+            ++order.itemCount;
+        }
+        if (quantity < 1 || quantity > MAX_ORDER_LINE_QUANTITY || order.itemQuantities[orderItem] + quantity > MAX_ORDER_LINE_QUANTITY) {
+            return ORDER_INVALID_QUANTITY;
+        }
+        order.itemQuantities[orderItem] += quantity;
+    }
+
+    return order.itemCount > 0 ? ORDER_SUCCESS : ORDER_INVALID_SYNTAX;
+}
+
+/**
+ * @brief checkOrderAvailability totals the ingredients the whole order needs and determines if inventory covers them.
+ *        Items sharing an ingredient are added together, so an order can fail even when each item alone is within its
+ *        quantity available.
+ * @param order = Parsed order line passed by reference (receives ingredients needed in catalog order)
+ * @param catalog = Catalog the order refers to
+ * @param inventory = Current inventory
+ * @param shortIngredientIndex = Index to receive the first ingredient that is short passed by reference
+ * @return = orderEntryError enum representing the result of the check
+ */
+
+orderEntryError checkOrderAvailability(orderLine &order, const truckCatalog &catalog, const catalogInventory &inventory, std::uint32_t &shortIngredientIndex) {
+    order.ingredientCount = 0;
+
+    for (int i = 0; i < order.itemCount; ++i) {
+        const catalogItem &item = catalog.items[order.itemIndexes[i]];
+        for (std::uint32_t j = item.recipeStart; j < item.recipeStart + item.recipeCount; ++j) {
+            const catalogRecipeComponent &component = catalog.recipeComponents[j];
+
+            // Insert ingredient in catalog order, or add to it if already needed.
+            int position = 0;
+            while (position < order.ingredientCount && order.ingredientIndexes[position] < component.ingredientIndex) {
+                ++position;
+            }
+            if (position == order.ingredientCount || order.ingredientIndexes[position] != component.ingredientIndex) {
+                if (order.ingredientCount == MAX_ORDER_LINE_INGREDIENTS) {
+                    return ORDER_TOO_MANY_ITEMS;
+                }
+                for (int k = order.ingredientCount; k > position; --k) {
+                    order.ingredientIndexes[k] = order.ingredientIndexes[k - 1];
+                    order.ingredientAmounts[k] = order.ingredientAmounts[k - 1];
+                }
+                order.ingredientIndexes[position] = component.ingredientIndex;
+                order.ingredientAmounts[position] = 0;
+                ++order.ingredientCount;
+            }
+            order.ingredientAmounts[position] += component.amount * order.itemQuantities[i];
+        }
+    }
+
+    for (int i = 0; i < order.ingredientCount; ++i) {
+        if (order.ingredientAmounts[i] > inventory.ingredientInventories[order.ingredientIndexes[i]]) {
+            shortIngredientIndex = order.ingredientIndexes[i];
+            return ORDER_INSUFFICIENT_INVENTORY;
+        }
+    }
+
+    return ORDER_SUCCESS;
+}
+
+/**
+ * @brief getOrderEntryErrorMessage returns a printable description of an order line error. Use
+ *        getOrderShortageMessage() for ORDER_INSUFFICIENT_INVENTORY to name the ingredient.
+ * @param errorResult = orderEntryError enum to describe
+ * @return = Null-terminated byte string constant describing the error
+ */
+
+const char *getOrderEntryErrorMessage(orderEntryError errorResult) {
+    if (errorResult == ORDER_SUCCESS) {
+        return "Order accepted.";
+    } else if (errorResult == ORDER_INVALID_SYNTAX) {
+        return "Invalid order. Please enter option x quantity for each item (e.g. 0x3 1x2 4x1).";
+    } else if (errorResult == ORDER_UNKNOWN_ITEM) {
+        return "Invalid order. Please enter only item options or codes from the menu.";
+    } else if (errorResult == ORDER_INVALID_QUANTITY) {
+        return "Invalid order. Please enter a valid quantity for each item.";
+    } else if (errorResult == ORDER_TOO_MANY_ITEMS) {
+        return "Invalid order. Please split the order into smaller orders.";
+    } else {
+        return "Not enough inventory for the order. Please reduce quantities or update inventory.";
+    }
+}
+
+/**
+ * @brief getOrderShortageMessage returns a message naming the ingredient an order is short of.
+ * @param ingredient = Ingredient that is short
+ * @return = String with message
+ */
+
+std::string getOrderShortageMessage(const catalogIngredient &ingredient) {
+    std::string ingredientName = ingredient.label;
+    for (std::string::size_type i = 0; i < ingredientName.size(); ++i) {
+        ingredientName[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(ingredientName[i])));
+    }
+
+    return "Not enough " + ingredientName + " for the order. Please reduce quantities or update inventory.";
+}
+
+/**
+ * @brief isOrderSeparator determines if a character separates item/quantity pairs.
+ * @param character = Character to check
+ * @return = Boolean indicating whether the character is a separator
+ */
+
+static bool isOrderSeparator(char character) {
+    return character == ' ' || character == '\t' || character == ',' || character == '\r';
+}
+
+/**
+ * @brief skipOrderBlanks skips spaces and tabs, which may surround the 'x' of a pair. Commas always end a pair.
+ * @param character = Pointer to first character to check
+ * @return = Pointer to first character that is not a space or tab
+ */
+
+static const char *skipOrderBlanks(const char *character) {
+    while (*character == ' ' || *character == '\t' || *character == '\r') {
+        ++character;
+    }
+
+    return character;
+}
+
+/**
+ * @brief findOrderWordEnd finds the end of a run of characters that are not separators.
+ * @param wordStart = Pointer to first character of word
+ * @return = Pointer past last character of word
+ */
+
+static const char *findOrderWordEnd(const char *wordStart) {
+    while (*wordStart != '\0' && !isOrderSeparator(*wordStart)) {
+        ++wordStart;
+    }
+
+    return wordStart;
+}
+
+/**
+ * @brief isOrderQuantity determines if a word is a quantity (one or more digits).
+ * @param quantityStart = Pointer to first character of word
+ * @param quantityEnd = Pointer past last character of word
+ * @return = Boolean indicating whether the word holds only digits
+ */
+
+static bool isOrderQuantity(const char *quantityStart, const char *quantityEnd) {
+    if (quantityStart == quantityEnd) {
+        return false;
+    }
+    for (; quantityStart < quantityEnd; ++quantityStart) {
+        if (!std::isdigit(static_cast<unsigned char>(*quantityStart))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief findQuantitySeparator finds the 'x' of a pair written as one word: the 'x' with something before it and only
+ *        digits, or nothing, after it ("BURGERx3", or "BURGERx" before "3").
+ * @param tokenStart = Pointer to first character of word
+ * @param tokenEnd = Pointer past last character of word
+ * @return = Pointer to separator, or nullptr if the word has none
+ */
+
+static const char *findQuantitySeparator(const char *tokenStart, const char *tokenEnd) {
+    const char *quantitySeparator = tokenEnd;
+    while (quantitySeparator > tokenStart && std::isdigit(static_cast<unsigned char>(quantitySeparator[-1]))) {
+        --quantitySeparator;
+    }
+    if (quantitySeparator - 1 <= tokenStart || !isQuantityMarker(quantitySeparator[-1])) {
+        return nullptr;
+    }
+
+    return quantitySeparator - 1;
+}
+
+/**
+ * @brief findOrderItem looks up a complete option number from the sell table page shown or a complete item code.
+ * @param itemStart = Pointer to first character of item
+ * @param itemEnd = Pointer past last character of item
+ * @param catalog = Catalog to look up item codes in
+ * @param pageItems = Item indexes for each option number on the page shown
+ * @param pageItemCount = Number of options on the page shown
+ * @return = Index of item in catalog, or -1 if there is no such item
+ */
+
+static std::int32_t findOrderItem(const char *itemStart, const char *itemEnd, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount) {
+    if (itemStart == itemEnd) {
+        return -1;
+    } else if (std::isdigit(static_cast<unsigned char>(*itemStart))) {
+        unsigned int optionNumber = 0;
+        const char *digit = itemStart;
+        while (digit < itemEnd && std::isdigit(static_cast<unsigned char>(*digit)) && optionNumber < pageItemCount) {
+            optionNumber = optionNumber * 10 + static_cast<unsigned int>(*digit - '0');
+            ++digit;
+        }
+        if (digit == itemEnd && optionNumber < pageItemCount) {
+            return static_cast<std::int32_t>(pageItems[optionNumber]);
+        }
+    } else if (itemEnd - itemStart <= MAX_CATALOG_CODE_LENGTH) {
+        char itemCode[MAX_CATALOG_CODE_LENGTH + 1];
+        int codeLength = 0;
+        for (const char *codeCharacter = itemStart; codeCharacter < itemEnd; ++codeCharacter) {
+            itemCode[codeLength++] = *codeCharacter;
+        }
+        itemCode[codeLength] = '\0';
+        return findCatalogItem(catalog, itemCode);
+    }
+
+    return -1;
+}
+
+/**
+ * @brief isQuantityMarker determines if a character is the 'x' between an item and its quantity.
+ * @param character = Character to check
+ * @return = Boolean indicating whether the character is 'x' or 'X'
+ */
+
+static bool isQuantityMarker(char character) {
+    return character == 'x' || character == 'X';
+}
@@ -0,0 +1,41 @@
+//================================================================================
+// Name        : order_entry.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Whole customer orders entered on a single line, such as
+//               "0x3 1x2 4x1", parsed and checked against inventory at once
+//================================================================================
+
+#ifndef ORDER_ENTRY_H
+#define ORDER_ENTRY_H
+
+#include <cstdint>
+#include <string>
+
+#include "catalog.h"
+
+// Most different items on one order line, and most different ingredients they may use
+const int MAX_ORDER_LINE_ITEMS       = 32;
+const int MAX_ORDER_LINE_INGREDIENTS = 64;
+
+enum orderEntryError { ORDER_SUCCESS, ORDER_INVALID_SYNTAX, ORDER_UNKNOWN_ITEM, ORDER_INVALID_QUANTITY, ORDER_TOO_MANY_ITEMS, ORDER_INSUFFICIENT_INVENTORY };
+
+// Parsed order line. Items appear once each, in order of first mention. Ingredients are filled in by
+// checkOrderAvailability() in catalog order.
+struct orderLine {
+    int itemCount;
+    std::uint32_t itemIndexes[MAX_ORDER_LINE_ITEMS];
+    std::int64_t itemQuantities[MAX_ORDER_LINE_ITEMS];
+    int ingredientCount;
+    std::uint32_t ingredientIndexes[MAX_ORDER_LINE_INGREDIENTS];
+    std::int64_t ingredientAmounts[MAX_ORDER_LINE_INGREDIENTS];
+};
+
+bool isOrderLine(const char *stringInputPointer, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount);
+orderEntryError parseOrderLine(orderLine &order, const char *stringInputPointer, const truckCatalog &catalog, const std::uint32_t *pageItems, unsigned int pageItemCount);
+orderEntryError checkOrderAvailability(orderLine &order, const truckCatalog &catalog, const catalogInventory &inventory, std::uint32_t &shortIngredientIndex);
+const char *getOrderEntryErrorMessage(orderEntryError errorResult);
+std::string getOrderShortageMessage(const catalogIngredient &ingredient);
+
+#endif // ORDER_ENTRY_H
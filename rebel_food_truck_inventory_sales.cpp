@@ -6,107 +6,120 @@
 // Description : Working Model of the Rebel Food Truck Inventory and Sales Program
 //================================================================================
 
+#include <algorithm>
+#include <cctype>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <ctime>
 #include <errno.h>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <vector>
 
+#include "inventory_publication.h"
+#include "order_entry.h"
+#include "sales_counters.h"
+#include "sales_export.h"
+#include "terminal_renderer.h"
+#include "truck_configuration.h"
+
 // Global Variable(s) ========================================================================================
 enum stringToIntegerError { STRTOINT_SUCCESS, STRTOINT_OVERFLOW, STRTOINT_UNDERFLOW, STRTOINT_INCONVERTIBLE };
 // ===========================================================================================================
 
 int getLongestStringLength(const std::vector<std::string>& tableStrings);
-stringToIntegerError stringToIntegerValidation (int &parsedInteger, const char *stringInputPointer, int base = 0);
-int getValidInteger(std::string stringInput, int minValue, int maxValue, int messageType = 0);
-
-// Current model only displays hamburgers, hotdogs, their chili versions, and chili.
-int main() {
-    // Food truck max capacities for each ingredient
-    const int HAMBURGER_PATTY_CAPACITY = 200;
-    const int HAMBURGER_BUN_CAPACITY   =  75;
-    const int HOTDOG_CAPACITY          = 200;
-    const int HOTDOG_BUN_CAPACITY      =  75;
-    const int CHILI_CAPACITY           = 500;
-
-    // Serving amount for each chili type
-    const int CHILI_SELF_SERVING  = 12;
-    const int CHILI_ADDON_SERVING =  4;
-
-    // Low inventory thresholds
-    const double LOW_INVENTORY_THRESHOLD       = 0.2;
-    const int HAMBURGER_PATTY_LOW_INVENTORY    = static_cast<int>(std::floor(static_cast<double>(HAMBURGER_PATTY_CAPACITY) * LOW_INVENTORY_THRESHOLD));
-    const int HAMBURGER_BUN_LOW_INVENTORY      = static_cast<int>(std::floor(static_cast<double>(HAMBURGER_BUN_CAPACITY)   * LOW_INVENTORY_THRESHOLD));
-    const int HOTDOG_LOW_INVENTORY             = static_cast<int>(std::floor(static_cast<double>(HOTDOG_CAPACITY)          * LOW_INVENTORY_THRESHOLD));
-    const int HOTDOG_BUN_LOW_INVENTORY         = static_cast<int>(std::floor(static_cast<double>(HOTDOG_BUN_CAPACITY)      * LOW_INVENTORY_THRESHOLD));
-    const int CHILI_LOW_INVENTORY              = static_cast<int>(std::floor(static_cast<double>(CHILI_CAPACITY)           * LOW_INVENTORY_THRESHOLD));
-
+stringToIntegerError stringToIntegerValidation (long long &parsedInteger, const char *stringInputPointer, int base = 0);
+long long getValidInteger(terminalScreen &screen, std::string stringInput, long long minValue, long long maxValue, int messageType = 0, const std::string &messageName = "");
+bool pickUpTruckConfiguration(const truckConfiguration *&configuration, catalogInventory &inventory, salesCounters &sales, inventoryPublication &publication, salesExporter &exporter, terminalScreen &screen);
+bool refreshTruckState(const truckConfiguration *&configuration, catalogInventory &inventory, salesCounters &sales, inventoryPublication &publication, salesExporter &exporter, terminalScreen &screen);
+void expireTruckInventory(const truckCatalog &catalog, catalogInventory &inventory, terminalScreen &screen);
+std::string getSalesReport(const truckCatalog &catalog, const salesCounters &sales);
+bool handleMenuPageCommand(const std::string &stringInput, unsigned int &page, std::string &filterText);
+std::string getMenuPageHint(unsigned int page, unsigned int pageCount, unsigned int visibleCount, const std::string &filterText);
+std::string getLowInventoryWarning(const catalogIngredient &ingredient);
+std::string getExpiredStockWarning(const catalogIngredient &ingredient, std::int64_t quantityExpired);
+std::string getTimeUntilExpiry(std::int64_t expiryTime, std::int64_t currentTime);
+std::string getWasteReport(const truckCatalog &catalog, const catalogInventory &inventory);
+
+// Menu is driven by the configured catalog (hamburgers, hotdogs, their chili versions, and chili by default).
+int main(int argc, char *argv[]) {
     // Empty inventory
     const int EMPTY_INVENTORY = 0;
 
-    // Item prices
-    const double HAMBURGER_PRICE  = 5.00;
-    const double HOTDOG_PRICE     = 5.00;
-    const double CHILI_SELF_PRICE = 4.00;
+    // Sell option selection representing a whole order entered on one line
+    const int ORDER_LINE_OPTION = -2;
+
+    // Option selection representing a page or filter change
+    const int PAGE_OPTION = -3;
+
+    // Option selection representing an ingredient or item chosen by code
+    const int CODE_OPTION = -4;
+
+    // Most ingredients or items listed on one page of a table
+    const unsigned int MENU_PAGE_SIZE = 20;
+
+    // Path of configuration file holding capacities, servings, prices, menu labels, and catalog
+    const char *configurationPath = argc > 1 ? argv[1] : DEFAULT_TRUCK_CONFIGURATION_PATH;
+
+    // Load configuration on top of defaults. A missing default file is not an error.
+    truckConfiguration *loadedConfiguration = new truckConfiguration;
+    setDefaultTruckConfiguration(*loadedConfiguration);
+    int configurationErrorLine = 0;
+    configurationError configurationResult = loadTruckConfiguration(*loadedConfiguration, configurationPath, configurationErrorLine);
+    if (configurationResult != CONFIG_SUCCESS && (configurationResult != CONFIG_UNREADABLE || argc > 1)) {
+        std::cerr << getConfigurationErrorMessage(configurationResult);
+        if (configurationErrorLine > 0) {
+            std::cerr << " (line " << configurationErrorLine << ")";
+        }
+        std::cerr << " Using default configuration." << std::endl;
+    }
 
-    // Chili addon prices
-    const double CHILI_ADDON_PRICE = 2.00;
-    const double CHILIBURGER_PRICE = HAMBURGER_PRICE + CHILI_ADDON_PRICE;
-    const double CHILIDOG_PRICE    = HOTDOG_PRICE    + CHILI_ADDON_PRICE;
+    // Configuration in use. Replaced only between screens by pickUpTruckConfiguration().
+    const truckConfiguration *configuration = loadedConfiguration;
 
-    // Sales tax
-    const double SALES_TAX = 0.05;
+    // Reload configuration in the background whenever the file changes.
+    startTruckConfigurationWatcher(configurationPath);
 
     // Option selections initialized for while loops
-    int mainOptionSelection      = -1;
-    int inventoryOptionSelection = -1;
-    int sellOptionSelection      = -1;
-
-    // Current ingredient inventories
-    int currentHamburgerPattyInventory = HAMBURGER_PATTY_CAPACITY;
-    int currentHamburgerBunInventory   = HAMBURGER_BUN_CAPACITY;
-    int currentHotdogInventory         = HOTDOG_CAPACITY;
-    int currentHotdogBunInventory      = HOTDOG_BUN_CAPACITY;
-    int currentChiliInventory          = CHILI_CAPACITY;
-
-    // Chili servings available
-    int currentChiliSelfServingsAvailable  = currentChiliInventory / CHILI_SELF_SERVING;
-    int currentChiliAddonServingsAvailable = currentChiliInventory / CHILI_ADDON_SERVING;
-
-    // Potentially new ingredient inventories to update current ingredient inventories
-    int newHamburgerPattyInventory;
-    int newHamburgerBunInventory;
-    int newHotdogInventory;
-    int newHotdogBunInventory;
-    int newChiliInventory;
-
-    // Max quantity of each item available to sell
-    int maxQuantityOfHamburgersToSell;
-    int maxQuantityOfHotdogsToSell;
-    int maxQuantityOfChiliSelfToSell;
-
-    // Max quantity of each item with chili addon available to sell
-    int maxQuantityOfChiliburgersToSell;
-    int maxQuantityOfChilidogsToSell;
-
-    // Existence of items initialized for if statements
-    bool isThereHamburger   = true;
-    bool isThereChiliburger = true;
-    bool isThereHotdog      = true;
-    bool isThereChilidog    = true;
-    bool isThereChiliSelf   = true;
-
-    // Quantities of each item that are currently being ordered
-    int quantityOfHamburgersToSell;
-    int quantityOfHotdogsToSell;
-    int quantityOfChiliSelfToSell;
-
-    // Quantities of each item with chili addon that are currently being ordered
-    int quantityOfChiliburgersToSell;
-    int quantityOfChilidogsToSell;
+    long long mainOptionSelection      = -1;
+    long long inventoryOptionSelection = -1;
+    long long sellOptionSelection      = -1;
+
+    // Current ingredient inventories and max quantity of each item available to sell, starting at full capacity
+    catalogInventory inventory;
+    initializeCatalogInventory(inventory, configuration->catalog, std::time(nullptr));
+
+    // Ingredients and items matching each table's filter, the page of each table shown, and each filter
+    std::vector<std::uint32_t> visibleIngredients;
+    std::vector<std::uint32_t> visibleItems;
+    unsigned int inventoryPage = 0;
+    unsigned int sellPage      = 0;
+    std::string inventoryFilter = "";
+    std::string sellFilter      = "";
+    filterCatalogIngredients(visibleIngredients, configuration->catalog, inventoryFilter);
+    filterCatalogItems(visibleItems, configuration->catalog, sellFilter);
+
+    // First entry and number of entries on the page of a table shown
+    unsigned int pageStart    = 0;
+    unsigned int pageRowCount = 0;
+
+    // Ingredient or item selected
+    std::uint32_t selectedIngredientIndex = 0;
+    std::uint32_t selectedItemIndex       = 0;
+
+    // Potentially new ingredient inventory to update current ingredient inventory
+    long long newIngredientInventory;
+
+    // Quantity of item currently being ordered
+    long long quantityToSell;
+
+    // Items on an order line entered at the sell prompt (e.g. "0x3 1x2 4x1" or "BURGER x3 DOG x1")
+    orderLine orderLineEntered;
+    orderEntryError orderLineResult;
+    std::uint32_t shortIngredientIndex = 0;
 
     // Cost of current item(s) sold
     double costOfItemsSold;
@@ -116,8 +129,29 @@ int main() {
     double orderTax;
     double orderTotal;
 
-    // Print title of the program.
-    std::cout << "Rebel Food Truck Inventory Sales Program" << std::endl;
+    // Quantity sold and revenue of each item since the program started, before tax
+    salesCounters sales;
+    initializeSalesCounters(sales, configuration->catalog.items.size());
+
+    // Shared memory segment publishing live inventory to external displays
+    inventoryPublication publication;
+    publicationError publicationResult = createInventoryPublication(publication, getInventoryPublicationName(), configuration->catalog);
+    if (publicationResult == PUBLICATION_IN_USE) {
+        std::cerr << "Inventory is already published by another running program. External displays will not be updated." << std::endl;
+    } else if (publicationResult != PUBLICATION_SUCCESS) {
+        std::cerr << "Inventory publication unavailable. External displays will not be updated." << std::endl;
+    }
+
+    // Order events appended to the sales export file for upload, if one is configured
+    salesExporter exporter;
+    salesExportError exportResult = openSalesExport(exporter, configuration->salesExportPath.c_str());
+    if (exportResult != SALES_EXPORT_SUCCESS) {
+        std::cerr << getSalesExportErrorMessage(exportResult) << " Sales will not be exported." << std::endl;
+    }
+
+    // Print title of the program. On a terminal, the title stays above each table and tables are redrawn in place.
+    terminalScreen screen;
+    initializeTerminalScreen(screen, "Rebel Food Truck Inventory Sales Program");
 
     // Vector of strings for main options to use to determine dynamic padding
     std::vector<std::string> mainNumberColumn = { "#", "0", "1", "2" };
@@ -136,6 +170,15 @@ int main() {
 
     // Execute while main option to quit is not selected.
     while (mainOptionSelection != 2) {
+        // Pick up reloaded configuration, remove expired stock, and publish inventory between screens. Show a reloaded
+        // catalog from the first page.
+        if (refreshTruckState(configuration, inventory, sales, publication, exporter, screen)) {
+            filterCatalogIngredients(visibleIngredients, configuration->catalog, inventoryFilter);
+            filterCatalogItems(visibleItems, configuration->catalog, sellFilter);
+            inventoryPage = 0;
+            sellPage = 0;
+        }
+
         // Print formatted table.
         std::stringstream mainOptionOSS;
         mainOptionOSS << std::endl;
@@ -143,370 +186,200 @@ int main() {
             mainOptionOSS << std::left << std::setw(MAIN_NUMBER_WIDTH) << mainNumberColumn.at(i) << std::right << std::setw(MAIN_OPTION_WIDTH) << mainOptionColumn.at(i) << std::endl;
         }
         mainOptionOSS << std::endl;
-        std::cout << mainOptionOSS.str();
+        drawTerminalFrame(screen, mainOptionOSS.str());
 
         // Execute until valid integer is parsed.
         do {
             // Prompt user for main option selection.
-            std::cout << "Enter option: " << std::flush;
+            printTerminalPrompt(screen, "Enter option: ");
 
             // Get string input.
             std::getline(std::cin, stringInput);
 
             // Validate input.
-            mainOptionSelection = getValidInteger(stringInput, std::stoi(mainNumberColumn.at(1)), std::stoi(mainNumberColumn.back()));
+            mainOptionSelection = getValidInteger(screen, stringInput, std::stoi(mainNumberColumn.at(1)), std::stoi(mainNumberColumn.back()));
         } while (mainOptionSelection == -1);
 
         // Determine main option selected.
         if (mainOptionSelection == std::stoi(mainNumberColumn.at(1))) { // Inventory menu
             do {
-                // String stream to get each string for current inventory column
-                std::stringstream inventoryOptionStringsOSS;
-
-                // String for current inventory column heading.
-                std::string currentInventoryHeading = "Current Inventory";
-
-                // String for hamburger patty inventory
-                inventoryOptionStringsOSS << currentHamburgerPattyInventory;
-                std::string currentHamburgerPattyInventoryString = inventoryOptionStringsOSS.str();
-                inventoryOptionStringsOSS.str("");
-                inventoryOptionStringsOSS.clear();
-
-                // String for hamburger bun inventory
-                inventoryOptionStringsOSS << currentHamburgerBunInventory;
-                std::string currentHamburgerBunInventoryString = inventoryOptionStringsOSS.str();
-                inventoryOptionStringsOSS.str("");
-                inventoryOptionStringsOSS.clear();
-
-                // String for hotdog inventory
-                inventoryOptionStringsOSS << currentHotdogInventory;
-                std::string currentHotdogInventoryString = inventoryOptionStringsOSS.str();
-                inventoryOptionStringsOSS.str("");
-                inventoryOptionStringsOSS.clear();
-
-                // String for hotdog bun inventory
-                inventoryOptionStringsOSS << currentHotdogBunInventory;
-                std::string currentHotdogBunInventoryString = inventoryOptionStringsOSS.str();
-                inventoryOptionStringsOSS.str("");
-                inventoryOptionStringsOSS.clear();
-
-                // String for chili inventory
-                inventoryOptionStringsOSS << currentChiliInventory << " oz";
-                std::string currentChiliInventoryString = inventoryOptionStringsOSS.str();
-                inventoryOptionStringsOSS.str("");
-                inventoryOptionStringsOSS.clear();
+                // Pick up reloaded configuration, remove expired stock, and publish inventory between screens. Show a reloaded
+                // catalog from the first page.
+                if (refreshTruckState(configuration, inventory, sales, publication, exporter, screen)) {
+                    filterCatalogIngredients(visibleIngredients, configuration->catalog, inventoryFilter);
+                    filterCatalogItems(visibleItems, configuration->catalog, sellFilter);
+                    inventoryPage = 0;
+                    sellPage = 0;
+                }
+
+                // Determine ingredients on the page shown.
+                const unsigned int INVENTORY_PAGE_COUNT = visibleIngredients.empty() ? 1 : (visibleIngredients.size() + MENU_PAGE_SIZE - 1) / MENU_PAGE_SIZE;
+                if (inventoryPage >= INVENTORY_PAGE_COUNT) {
+                    inventoryPage = INVENTORY_PAGE_COUNT - 1;
+                }
+                pageStart = inventoryPage * MENU_PAGE_SIZE;
+                pageRowCount = std::min<unsigned int>(MENU_PAGE_SIZE, visibleIngredients.size() - pageStart);
 
                 // Vector of strings for inventory options to use to determine dynamic padding
-                std::vector<std::string> inventoryNumberColumn           = { "#", "0", "1", "2", "3", "4", "5" };
-                std::vector<std::string> inventoryItemOptionColumn       = { "Item/Option", "Hamburger Patties", "Hamburger Buns", "Hotdogs", "Hotdog Buns", "Chili", "Return" };
-                std::vector<std::string> inventoryCurrentInventoryColumn = { currentInventoryHeading, currentHamburgerPattyInventoryString, currentHamburgerBunInventoryString, currentHotdogInventoryString, currentHotdogBunInventoryString, currentChiliInventoryString };
+                std::vector<std::string> inventoryNumberColumn           = { "#" };
+                std::vector<std::string> inventoryCodeColumn             = { "Code" };
+                std::vector<std::string> inventoryItemOptionColumn       = { "Item/Option" };
+                std::vector<std::string> inventoryCurrentInventoryColumn = { "Current Inventory" };
+                std::vector<std::string> inventoryExpiresInColumn        = { "Oldest Expires In" };
+                const std::int64_t INVENTORY_TIME = std::time(nullptr);
+                for (unsigned int i = 0; i < pageRowCount; ++i) {
+                    const std::uint32_t ingredientIndex = visibleIngredients[pageStart + i];
+                    const catalogIngredient &ingredient = configuration->catalog.ingredients[ingredientIndex];
+
+                    inventoryNumberColumn.push_back(std::to_string(i));
+                    inventoryCodeColumn.push_back(ingredient.code);
+                    inventoryItemOptionColumn.push_back(ingredient.label);
+                    inventoryCurrentInventoryColumn.push_back(std::to_string(inventory.ingredientInventories[ingredientIndex]) + (ingredient.unit.empty() ? "" : " " + ingredient.unit));
+                    inventoryExpiresInColumn.push_back(getTimeUntilExpiry(getOldestLotExpiry(inventory.ingredientLots[ingredientIndex]), INVENTORY_TIME));
+                }
+                inventoryNumberColumn.push_back(std::to_string(pageRowCount));
+                inventoryCodeColumn.push_back("");
+                inventoryItemOptionColumn.push_back("Return");
 
                 // Length of longest string of each inventory option column
                 const int LONGEST_INVENTORY_NUMBER_LENGTH            = getLongestStringLength(inventoryNumberColumn);
+                const int LONGEST_INVENTORY_CODE_LENGTH              = getLongestStringLength(inventoryCodeColumn);
                 const int LONGEST_INVENTORY_ITEM_OPTION_LENGTH       = getLongestStringLength(inventoryItemOptionColumn);
                 const int LONGEST_INVENTORY_CURRENT_INVENTORY_LENGTH = getLongestStringLength(inventoryCurrentInventoryColumn);
+                const int LONGEST_INVENTORY_EXPIRES_IN_LENGTH        = getLongestStringLength(inventoryExpiresInColumn);
 
-                // Lengths of each width for padding
+                // Lengths of each width for padding. Codes are listed only for a catalog from the configuration file, and
+                // expiry only for a catalog with perishable ingredients.
                 const int INVENTORY_NUMBER_WIDTH            = LONGEST_INVENTORY_NUMBER_LENGTH;
+                const int INVENTORY_CODE_WIDTH              = configuration->isCustomCatalog ? LONGEST_INVENTORY_CODE_LENGTH + 4 : 0;
                 const int INVENTORY_ITEM_OPTION_WIDTH       = LONGEST_INVENTORY_ITEM_OPTION_LENGTH + 4;
                 const int INVENTORY_CURRENT_INVENTORY_WIDTH = LONGEST_INVENTORY_CURRENT_INVENTORY_LENGTH + 4;
+                const int INVENTORY_EXPIRES_IN_WIDTH        = LONGEST_INVENTORY_EXPIRES_IN_LENGTH + 4;
 
                 // Print formatted table.
                 std::stringstream inventoryOptionOSS;
                 inventoryOptionOSS << std::endl;
                 for (unsigned int i = 0; i < inventoryNumberColumn.size() - 1; ++i) {
-                    inventoryOptionOSS << std::left << std::setw(INVENTORY_NUMBER_WIDTH) << inventoryNumberColumn.at(i) << std::right << std::setw(INVENTORY_ITEM_OPTION_WIDTH) << inventoryItemOptionColumn.at(i) << std::setw(INVENTORY_CURRENT_INVENTORY_WIDTH) << inventoryCurrentInventoryColumn.at(i) << std::endl;
+                    inventoryOptionOSS << std::left << std::setw(INVENTORY_NUMBER_WIDTH) << inventoryNumberColumn.at(i) << std::right;
+                    if (configuration->isCustomCatalog) {
+                        inventoryOptionOSS << std::setw(INVENTORY_CODE_WIDTH) << inventoryCodeColumn.at(i);
+                    }
+                    inventoryOptionOSS << std::setw(INVENTORY_ITEM_OPTION_WIDTH) << inventoryItemOptionColumn.at(i) << std::setw(INVENTORY_CURRENT_INVENTORY_WIDTH) << inventoryCurrentInventoryColumn.at(i);
+                    if (configuration->catalog.hasPerishableIngredients) {
+                        inventoryOptionOSS << std::setw(INVENTORY_EXPIRES_IN_WIDTH) << inventoryExpiresInColumn.at(i);
+                    }
+                    inventoryOptionOSS << std::endl;
                 }
-                inventoryOptionOSS << std::left << std::setw(INVENTORY_NUMBER_WIDTH) << inventoryNumberColumn.back() << std::right << std::setw(INVENTORY_ITEM_OPTION_WIDTH) << inventoryItemOptionColumn.back() << std::endl << std::endl;
-                std::cout << inventoryOptionOSS.str();
+                inventoryOptionOSS << std::left << std::setw(INVENTORY_NUMBER_WIDTH) << inventoryNumberColumn.back() << std::right << std::setw(INVENTORY_CODE_WIDTH + INVENTORY_ITEM_OPTION_WIDTH) << inventoryItemOptionColumn.back() << std::endl << std::endl;
+                inventoryOptionOSS << getMenuPageHint(inventoryPage, INVENTORY_PAGE_COUNT, visibleIngredients.size(), inventoryFilter);
+                drawTerminalFrame(screen, inventoryOptionOSS.str());
 
-                // Execute until valid integer is parsed.
+                // Execute until valid integer, code, or page command is parsed.
                 do {
                     // Prompt user for inventory option selection.
-                    std::cout << "Enter option to update inventory: " << std::flush;
+                    printTerminalPrompt(screen, "Enter option to update inventory: ");
 
                     // Get string input.
                     std::getline(std::cin, stringInput);
 
-                    // Validate input.
-                    inventoryOptionSelection = getValidInteger(stringInput, std::stoi(inventoryNumberColumn.at(1)), std::stoi(inventoryNumberColumn.back()));
+                    // Determine if input changes the page or filter, names an ingredient code, or is an option number.
+                    std::int32_t codeIngredientIndex = findCatalogIngredient(configuration->catalog, stringInput.c_str());
+                    if (handleMenuPageCommand(stringInput, inventoryPage, inventoryFilter)) {
+                        filterCatalogIngredients(visibleIngredients, configuration->catalog, inventoryFilter);
+                        inventoryOptionSelection = PAGE_OPTION;
+                    } else if (codeIngredientIndex >= 0) {
+                        selectedIngredientIndex = static_cast<std::uint32_t>(codeIngredientIndex);
+                        inventoryOptionSelection = CODE_OPTION;
+                    } else {
+                        inventoryOptionSelection = getValidInteger(screen, stringInput, 0, pageRowCount);
+                    }
                 } while (inventoryOptionSelection == -1);
 
                 // Determine ingredient selected.
-                if (inventoryOptionSelection == 0) { // Hamburger Patty
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for inventory amount.
-                        std::cout << std::endl << "Enter new hamburger patty inventory: " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
-
-                        // Validate input.
-                        newHamburgerPattyInventory = getValidInteger(stringInput, EMPTY_INVENTORY, HAMBURGER_PATTY_CAPACITY, 1);
-                    } while (newHamburgerPattyInventory == -1);
-
-                    // Assign new inventory to current inventory.
-                    currentHamburgerPattyInventory = newHamburgerPattyInventory;
-                } else if (inventoryOptionSelection == 1) { // Hamburger Bun
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for inventory amount.
-                        std::cout << std::endl << "Enter new hamburger bun inventory: " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
-
-                        // Validate input.
-                        newHamburgerBunInventory = getValidInteger(stringInput, EMPTY_INVENTORY, HAMBURGER_BUN_CAPACITY, 2);
-                    } while (newHamburgerBunInventory == -1);
-
-                    // Assign new inventory to current inventory.
-                    currentHamburgerBunInventory = newHamburgerBunInventory;
-                } else if (inventoryOptionSelection == 2) { // Hotdog
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for inventory amount.
-                        std::cout << std::endl << "Enter new hotdog inventory: " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
-
-                        // Validate input.
-                        newHotdogInventory = getValidInteger(stringInput, EMPTY_INVENTORY, HOTDOG_CAPACITY, 3);
-                    } while (newHotdogInventory == -1);
-
-                    // Assign new inventory to current inventory.
-                    currentHotdogInventory = newHotdogInventory;
-                } else if (inventoryOptionSelection == 3) { // Hotdog Bun
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for inventory amount.
-                        std::cout << std::endl << "Enter new hotdog bun inventory: " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
+                if (inventoryOptionSelection >= 0 && inventoryOptionSelection < pageRowCount) {
+                    selectedIngredientIndex = visibleIngredients[pageStart + inventoryOptionSelection];
+                }
 
-                        // Validate input.
-                        newHotdogBunInventory = getValidInteger(stringInput, EMPTY_INVENTORY, HOTDOG_BUN_CAPACITY, 4);
-                    } while (newHotdogBunInventory == -1);
+                if (inventoryOptionSelection == pageRowCount) { // Return
+                    // Exit loop.
+                    break;
+                } else if (inventoryOptionSelection != PAGE_OPTION) { // Ingredient
+                    const catalogIngredient &ingredient = configuration->catalog.ingredients[selectedIngredientIndex];
 
-                    // Assign new inventory to current inventory.
-                    currentHotdogBunInventory = newHotdogBunInventory;
-                } else if (inventoryOptionSelection == 4) { // Chili
                     // Execute until valid integer is parsed.
                     do {
                         // Prompt for inventory amount.
-                        std::cout << std::endl << "Enter new chili inventory: " << std::flush;
+                        printTerminalPrompt(screen, "\nEnter new " + ingredient.promptName + " inventory: ");
 
                         // Get string input.
                         std::getline(std::cin, stringInput);
 
                         // Validate input.
-                        newChiliInventory = getValidInteger(stringInput, EMPTY_INVENTORY, CHILI_CAPACITY, 5);
-                    } while (newChiliInventory == -1);
+                        newIngredientInventory = getValidInteger(screen, stringInput, EMPTY_INVENTORY, ingredient.capacity, 1, ingredient.promptName);
+                    } while (newIngredientInventory == -1);
 
-                    // Assign new inventory to current inventory.
-                    currentChiliInventory = newChiliInventory;
-
-                    // Calculate quantity of each chili serving type available.
-                    currentChiliSelfServingsAvailable  = currentChiliInventory / CHILI_SELF_SERVING;
-                    currentChiliAddonServingsAvailable = currentChiliInventory / CHILI_ADDON_SERVING;
-                } else if (inventoryOptionSelection == 5) { // Return
-                    // Exit loop.
-                    break;
+                    // Assign new inventory to current inventory and recalculate items using the ingredient. Stock added is
+                    // received as a fresh lot; stock removed is taken from the oldest lots.
+                    setIngredientInventory(inventory, configuration->catalog, selectedIngredientIndex, newIngredientInventory, std::time(nullptr));
                 }
-            } while (inventoryOptionSelection != 5);
+            } while (inventoryOptionSelection != pageRowCount);
         } else if (mainOptionSelection == std::stoi(mainNumberColumn.at(2))) { // Sell menu
-            // Initialize order subtotal.
+            // Initialize order subtotal and start a new order in the sales export.
             orderSubtotal = 0;
+            startSalesExportOrder(exporter);
 
             do {
-                // Determine max quantity of hamburgers available to sell based on ingredient with lowest stock.
-                if (currentHamburgerPattyInventory > currentHamburgerBunInventory) {
-                    maxQuantityOfHamburgersToSell = currentHamburgerBunInventory;
-                } else {
-                    maxQuantityOfHamburgersToSell = currentHamburgerPattyInventory;
-                }
-
-                // Determine max quantity of chiliburgers available to sell based on ingredient with lowest stock.
-                if (currentChiliAddonServingsAvailable > maxQuantityOfHamburgersToSell) {
-                    maxQuantityOfChiliburgersToSell = maxQuantityOfHamburgersToSell;
-                } else {
-                    maxQuantityOfChiliburgersToSell = currentChiliAddonServingsAvailable;
-                }
-
-                // Determine max quantity of hotdogs available to sell based on ingredient with lowest stock.
-                if (currentHotdogInventory > currentHotdogBunInventory) {
-                    maxQuantityOfHotdogsToSell = currentHotdogBunInventory;
-                } else {
-                    maxQuantityOfHotdogsToSell = currentHotdogInventory;
-                }
-
-                // Determine max quantity of chilidogs available to sell based on ingredient with lowest stock.
-                if (currentChiliAddonServingsAvailable > maxQuantityOfHotdogsToSell) {
-                    maxQuantityOfChilidogsToSell = maxQuantityOfHotdogsToSell;
-                } else {
-                    maxQuantityOfChilidogsToSell = currentChiliAddonServingsAvailable;
-                }
-
-                // Determine max quantity of chili available to sell based on servings available.
-                maxQuantityOfChiliSelfToSell = currentChiliSelfServingsAvailable;
-
-                // Determine if hamburgers exist.
-                if (maxQuantityOfHamburgersToSell > EMPTY_INVENTORY) {
-                    isThereHamburger = true;
-                } else {
-                    isThereHamburger = false;
-                }
-
-                // Determine if chiliburgers exist.
-                if (maxQuantityOfChiliburgersToSell > EMPTY_INVENTORY) {
-                    isThereChiliburger = true;
-                } else {
-                    isThereChiliburger = false;
-                }
-
-                // Determine if hotdogs exist.
-                if (maxQuantityOfHotdogsToSell > EMPTY_INVENTORY) {
-                    isThereHotdog = true;
-                } else {
-                    isThereHotdog = false;
-                }
-
-                // Determine if chilidogs exist.
-                if (maxQuantityOfChilidogsToSell > EMPTY_INVENTORY) {
-                    isThereChilidog = true;
-                } else {
-                    isThereChilidog = false;
+                // Pick up reloaded configuration, remove expired stock, and publish inventory between screens. Show a reloaded
+                // catalog from the first page.
+                if (refreshTruckState(configuration, inventory, sales, publication, exporter, screen)) {
+                    filterCatalogIngredients(visibleIngredients, configuration->catalog, inventoryFilter);
+                    filterCatalogItems(visibleItems, configuration->catalog, sellFilter);
+                    inventoryPage = 0;
+                    sellPage = 0;
                 }
 
-                // Determine if chili exists.
-                if (maxQuantityOfChiliSelfToSell > EMPTY_INVENTORY) {
-                    isThereChiliSelf = true;
-                } else {
-                    isThereChiliSelf = false;
+                // Determine items on the page shown.
+                const unsigned int SELL_PAGE_COUNT = visibleItems.empty() ? 1 : (visibleItems.size() + MENU_PAGE_SIZE - 1) / MENU_PAGE_SIZE;
+                if (sellPage >= SELL_PAGE_COUNT) {
+                    sellPage = SELL_PAGE_COUNT - 1;
                 }
-
-                // String stream to get each string for item/option column
-                std::stringstream sellOptionStringsOSS;
-
-                // String for item/option column heading
-                std::string itemOptionHeading = "Item/Option";
-
-                // String for hamburger
-                sellOptionStringsOSS << "Hamburger";
-                std::string hamburgerString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chiliburger
-                sellOptionStringsOSS << "Chiliburger";
-                std::string chiliburgerString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for hotdog
-                sellOptionStringsOSS << "Hotdog";
-                std::string hotdogString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chilidog
-                sellOptionStringsOSS << "Chilidog";
-                std::string chilidogString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chili
-                sellOptionStringsOSS << "Chili (" << CHILI_SELF_SERVING << " oz)";
-                std::string chiliSelfString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for return
-                std::string returnString = "Return";
-
-                // String for quantity available heading
-                std::string quantityAvailableHeading = "Quantity Available";
-
-                // String for max quantity of hamburgers available
-                sellOptionStringsOSS << maxQuantityOfHamburgersToSell;
-                std::string maxQuantityOfHamburgersToSellString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for max quantity of chiliburgers available
-                sellOptionStringsOSS << maxQuantityOfChiliburgersToSell;
-                std::string maxQuantityOfChiliburgersToSellString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for max quantity of hotdogs available
-                sellOptionStringsOSS << maxQuantityOfHotdogsToSell;
-                std::string maxQuantityOfHotdogsToSellString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for max quantity of chilidogs available
-                sellOptionStringsOSS << maxQuantityOfChilidogsToSell;
-                std::string maxQuantityOfChilidogsToSellString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for max quantity of chili available
-                sellOptionStringsOSS << maxQuantityOfChiliSelfToSell;
-                std::string maxQuantityOfChiliSelfToSellString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for cost per item heading
-                std::string costPerItemHeading = "Cost Per Item";
-
-                // String for hamburger price
-                sellOptionStringsOSS << "$ " << std::fixed << std::setprecision(2) << HAMBURGER_PRICE;
-                std::string hamburgerPriceString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chiliburger price
-                sellOptionStringsOSS << "$ " << CHILIBURGER_PRICE;
-                std::string chiliburgerPriceString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for hotdog price
-                sellOptionStringsOSS << "$ " << HOTDOG_PRICE;
-                std::string hotdogPriceString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chilidog price
-                sellOptionStringsOSS << "$ " << CHILIDOG_PRICE;
-                std::string chilidogPriceString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
-
-                // String for chili
-                sellOptionStringsOSS << "$ " << CHILI_SELF_PRICE;
-                std::string chiliSelfPriceString = sellOptionStringsOSS.str();
-                sellOptionStringsOSS.str("");
-                sellOptionStringsOSS.clear();
+                pageStart = sellPage * MENU_PAGE_SIZE;
+                pageRowCount = std::min<unsigned int>(MENU_PAGE_SIZE, visibleItems.size() - pageStart);
 
                 // Vector of strings for sell options to use to determine dynamic padding
-                std::vector<std::string> sellNumberColumn            = { "#", "0", "1", "2", "3", "4", "5" };
-                std::vector<std::string> sellItemOptionColumn        = { itemOptionHeading, hamburgerString, chiliburgerString, hotdogString, chilidogString, chiliSelfString, returnString };
-                std::vector<std::string> sellQuantityAvailableColumn = { quantityAvailableHeading, maxQuantityOfHamburgersToSellString, maxQuantityOfChiliburgersToSellString, maxQuantityOfHotdogsToSellString, maxQuantityOfChilidogsToSellString, maxQuantityOfChiliSelfToSellString };
-                std::vector<std::string> sellCostPerItemColumn       = { costPerItemHeading, hamburgerPriceString, chiliburgerPriceString, hotdogPriceString, chilidogPriceString, chiliSelfPriceString };
+                std::vector<std::string> sellNumberColumn            = { "#" };
+                std::vector<std::string> sellCodeColumn              = { "Code" };
+                std::vector<std::string> sellItemOptionColumn        = { "Item/Option" };
+                std::vector<std::string> sellQuantityAvailableColumn = { "Quantity Available" };
+                std::vector<std::string> sellCostPerItemColumn       = { "Cost Per Item" };
+                for (unsigned int i = 0; i < pageRowCount; ++i) {
+                    const std::uint32_t itemIndex = visibleItems[pageStart + i];
+                    const catalogItem &item = configuration->catalog.items[itemIndex];
+
+                    // String for item price
+                    std::stringstream itemPriceOSS;
+                    itemPriceOSS << "$ " << std::fixed << std::setprecision(2) << item.price;
+
+                    sellNumberColumn.push_back(std::to_string(i));
+                    sellCodeColumn.push_back(item.code);
+                    sellItemOptionColumn.push_back(item.label);
+                    sellQuantityAvailableColumn.push_back(std::to_string(inventory.itemAvailability[itemIndex]));
+                    sellCostPerItemColumn.push_back(itemPriceOSS.str());
+                }
+                sellNumberColumn.push_back(std::to_string(pageRowCount));
+                sellCodeColumn.push_back("");
+                sellItemOptionColumn.push_back("Return");
 
                 // Length of longest string of each sell option column
                 const int LONGEST_SELL_NUMBER_LENGTH             = getLongestStringLength(sellNumberColumn);
+                const int LONGEST_SELL_CODE_LENGTH               = getLongestStringLength(sellCodeColumn);
                 const int LONGEST_SELL_ITEM_OPTION_LENGTH        = getLongestStringLength(sellItemOptionColumn);
                 const int LONGEST_SELL_QUANTITY_AVAILABLE_LENGTH = getLongestStringLength(sellQuantityAvailableColumn);
                 const int LONGEST_SELL_COST_PER_ITEM_LENGTH      = getLongestStringLength(sellCostPerItemColumn);
 
-                // Lengths of each width for padding
+                // Lengths of each width for padding. Codes are listed only for a catalog from the configuration file.
                 const int SELL_NUMBER_WIDTH             = LONGEST_SELL_NUMBER_LENGTH;
+                const int SELL_CODE_WIDTH               = configuration->isCustomCatalog ? LONGEST_SELL_CODE_LENGTH + 4 : 0;
                 const int SELL_ITEM_OPTION_WIDTH        = LONGEST_SELL_ITEM_OPTION_LENGTH + 4;
                 const int SELL_QUANTITY_AVAILABLE_WIDTH = LONGEST_SELL_QUANTITY_AVAILABLE_LENGTH + 4;
                 const int SELL_COST_PER_ITEM_WIDTH      = LONGEST_SELL_COST_PER_ITEM_LENGTH + 4;
@@ -515,207 +388,193 @@ int main() {
                 std::stringstream sellOptionOSS;
                 sellOptionOSS << std::endl;
                 for (unsigned int i = 0; i < sellNumberColumn.size() - 1; ++i) {
-                    sellOptionOSS << std::left << std::setw(SELL_NUMBER_WIDTH) << sellNumberColumn.at(i) << std::right << std::setw(SELL_ITEM_OPTION_WIDTH) << sellItemOptionColumn.at(i) << std::setw(SELL_QUANTITY_AVAILABLE_WIDTH) << sellQuantityAvailableColumn.at(i) << std::setw(SELL_COST_PER_ITEM_WIDTH) << sellCostPerItemColumn.at(i) << std::endl;
+                    sellOptionOSS << std::left << std::setw(SELL_NUMBER_WIDTH) << sellNumberColumn.at(i) << std::right;
+                    if (configuration->isCustomCatalog) {
+                        sellOptionOSS << std::setw(SELL_CODE_WIDTH) << sellCodeColumn.at(i);
+                    }
+                    sellOptionOSS << std::setw(SELL_ITEM_OPTION_WIDTH) << sellItemOptionColumn.at(i) << std::setw(SELL_QUANTITY_AVAILABLE_WIDTH) << sellQuantityAvailableColumn.at(i) << std::setw(SELL_COST_PER_ITEM_WIDTH) << sellCostPerItemColumn.at(i) << std::endl;
                 }
-                sellOptionOSS << std::left << std::setw(SELL_NUMBER_WIDTH) << sellNumberColumn.back() << std::right << std::setw(SELL_ITEM_OPTION_WIDTH) << sellItemOptionColumn.back() << std::endl << std::endl;
-                std::cout << sellOptionOSS.str();
+                sellOptionOSS << std::left << std::setw(SELL_NUMBER_WIDTH) << sellNumberColumn.back() << std::right << std::setw(SELL_CODE_WIDTH + SELL_ITEM_OPTION_WIDTH) << sellItemOptionColumn.back() << std::endl << std::endl;
+                sellOptionOSS << getMenuPageHint(sellPage, SELL_PAGE_COUNT, visibleItems.size(), sellFilter);
+                drawTerminalFrame(screen, sellOptionOSS.str());
 
-                // Execute until valid integer is parsed.
+                // Execute until valid integer, code, order line, or page command is parsed.
                 do {
                     // Prompt user for sell option selection.
-                    std::cout << "Enter option for customer order: " << std::flush;
+                    printTerminalPrompt(screen, "Enter option for customer order: ");
 
                     // Get string input.
                     std::getline(std::cin, stringInput);
 
-                    // Validate input.
-                    sellOptionSelection = getValidInteger(stringInput, std::stoi(sellNumberColumn.at(1)), std::stoi(sellNumberColumn.back()));
+                    // Remove stock that expired while the prompt waited, so the order is checked against stock on hand.
+                    expireTruckInventory(configuration->catalog, inventory, screen);
+
+                    // Determine if input changes the page or filter, names an item code, is a whole order on one line, or is an option number.
+                    std::int32_t codeItemIndex = findCatalogItem(configuration->catalog, stringInput.c_str());
+                    if (handleMenuPageCommand(stringInput, sellPage, sellFilter)) {
+                        filterCatalogItems(visibleItems, configuration->catalog, sellFilter);
+                        sellOptionSelection = PAGE_OPTION;
+                    } else if (codeItemIndex >= 0) {
+                        selectedItemIndex = static_cast<std::uint32_t>(codeItemIndex);
+                        sellOptionSelection = CODE_OPTION;
+                    } else if (isOrderLine(stringInput.c_str(), configuration->catalog, visibleItems.data() + pageStart, pageRowCount)) {
+                        // Parse every item and check the order as a whole against inventory.
+                        orderLineResult = parseOrderLine(orderLineEntered, stringInput.c_str(), configuration->catalog, visibleItems.data() + pageStart, pageRowCount);
+                        if (orderLineResult == ORDER_SUCCESS) {
+                            orderLineResult = checkOrderAvailability(orderLineEntered, configuration->catalog, inventory, shortIngredientIndex);
+                        }
+
+                        if (orderLineResult == ORDER_SUCCESS) {
+                            sellOptionSelection = ORDER_LINE_OPTION;
+                        } else if (orderLineResult == ORDER_INSUFFICIENT_INVENTORY) {
+                            printTerminalPromptMessage(screen, getOrderShortageMessage(configuration->catalog.ingredients[shortIngredientIndex]) + "\n");
+                            sellOptionSelection = -1;
+                        } else {
+                            printTerminalPromptMessage(screen, std::string(getOrderEntryErrorMessage(orderLineResult)) + "\n");
+                            sellOptionSelection = -1;
+                        }
+                    } else {
+                        sellOptionSelection = getValidInteger(screen, stringInput, 0, pageRowCount);
+                    }
                 } while (sellOptionSelection == -1);
 
                 // Determine item selected.
-                if (sellOptionSelection == 0 && isThereHamburger) { // Hamburger
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for quantity amount.
-                        std::cout << std::endl << "Enter quantity (max " << maxQuantityOfHamburgersToSell << "): " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
-
-                        // Validate input.
-                        quantityOfHamburgersToSell = getValidInteger(stringInput, EMPTY_INVENTORY, maxQuantityOfHamburgersToSell, 6);
-                    } while (quantityOfHamburgersToSell == -1);
-
-                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
-                    currentHamburgerPattyInventory -= quantityOfHamburgersToSell;
-                    if (currentHamburgerPattyInventory <= HAMBURGER_PATTY_LOW_INVENTORY) {
-                        std::cout << "Warning: Hamburger patty inventory low. Please restock soon." << std::endl;
-                    }
+                if (sellOptionSelection >= 0 && sellOptionSelection < pageRowCount) {
+                    selectedItemIndex = visibleItems[pageStart + sellOptionSelection];
+                }
 
-                    currentHamburgerBunInventory -= quantityOfHamburgersToSell;
-                    if (currentHamburgerBunInventory <= HAMBURGER_BUN_LOW_INVENTORY) {
-                        std::cout << "Warning: Hamburger bun inventory low. Please restock soon." << std::endl;
-                    }
+                if (sellOptionSelection == PAGE_OPTION) { // Page or filter change
+                    // Redraw table.
+                    continue;
+                } else if ((sellOptionSelection == CODE_OPTION || (sellOptionSelection >= 0 && sellOptionSelection < pageRowCount)) && inventory.itemAvailability[selectedItemIndex] > EMPTY_INVENTORY) { // Item
+                    const catalogItem &item = configuration->catalog.items[selectedItemIndex];
 
-                    // Calculate item total cost.
-                    costOfItemsSold = quantityOfHamburgersToSell * HAMBURGER_PRICE;
-
-                    // Increment order subtotal with item total cost.
-                    orderSubtotal += costOfItemsSold;
-                } else if (sellOptionSelection == 1 && isThereChiliburger) { // Chiliburger
                     // Execute until valid integer is parsed.
                     do {
                         // Prompt for quantity amount.
-                        std::cout << std::endl << "Enter quantity (max " << maxQuantityOfChiliburgersToSell << "): " << std::flush;
+                        printTerminalPrompt(screen, "\nEnter quantity (max " + std::to_string(inventory.itemAvailability[selectedItemIndex]) + "): ");
 
                         // Get string input.
                         std::getline(std::cin, stringInput);
 
-                        // Validate input.
-                        quantityOfChiliburgersToSell = getValidInteger(stringInput, EMPTY_INVENTORY, maxQuantityOfChiliburgersToSell, 7);
-                    } while (quantityOfChiliburgersToSell == -1);
-
-                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
-                    currentHamburgerPattyInventory -= quantityOfChiliburgersToSell;
-                    if (currentHamburgerPattyInventory <= HAMBURGER_PATTY_LOW_INVENTORY) {
-                        std::cout << "Warning: Hamburger patty inventory low. Please restock soon." << std::endl;
-                    }
-
-                    currentHamburgerBunInventory -= quantityOfChiliburgersToSell;
-                    if (currentHamburgerBunInventory <= HAMBURGER_BUN_LOW_INVENTORY) {
-                        std::cout << "Warning: Hamburger bun inventory low. Please restock soon." << std::endl;
-                    }
-
-                    currentChiliInventory -= quantityOfChiliburgersToSell * CHILI_ADDON_SERVING;
-                    if (currentChiliInventory <= CHILI_LOW_INVENTORY) {
-                        std::cout << "Warning: Chili inventory low. Please restock soon." << std::endl;
-                    }
-
-                    // Calculate quantity of each chili serving type available.
-                    currentChiliSelfServingsAvailable  = currentChiliInventory / CHILI_SELF_SERVING;
-                    currentChiliAddonServingsAvailable = currentChiliInventory / CHILI_ADDON_SERVING;
-
-                    // Calculate item total cost.
-                    costOfItemsSold = quantityOfChiliburgersToSell * CHILIBURGER_PRICE;
-
-                    // Increment order subtotal with item total cost.
-                    orderSubtotal += costOfItemsSold;
-                } else if (sellOptionSelection == 2 && isThereHotdog) { // Hotdog
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for quantity amount.
-                        std::cout << std::endl << "Enter quantity (max " << maxQuantityOfHotdogsToSell << "): " << std::flush;
-
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
+                        // Remove stock that expired while the prompt waited. A quantity no longer available is asked for again.
+                        expireTruckInventory(configuration->catalog, inventory, screen);
 
                         // Validate input.
-                        quantityOfHotdogsToSell = getValidInteger(stringInput, EMPTY_INVENTORY, maxQuantityOfHotdogsToSell, 8);
-                    } while (quantityOfHotdogsToSell == -1);
+                        quantityToSell = getValidInteger(screen, stringInput, EMPTY_INVENTORY, inventory.itemAvailability[selectedItemIndex], 2, item.pluralName);
+                    } while (quantityToSell == -1);
 
-                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
-                    currentHotdogInventory -= quantityOfHotdogsToSell;
-                    if (currentHotdogInventory <= HOTDOG_LOW_INVENTORY) {
-                        std::cout << "Warning: Hotdog inventory low. Please restock soon." << std::endl;
+                    // Sell nothing for a quantity of 0.
+                    if (quantityToSell == EMPTY_INVENTORY) {
+                        continue;
                     }
 
-                    currentHotdogBunInventory -= quantityOfHotdogsToSell;
-                    if (currentHotdogBunInventory <= HOTDOG_BUN_LOW_INVENTORY) {
-                        std::cout << "Warning: Hotdog bun inventory low. Please restock soon." << std::endl;
+                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
+                    sellCatalogItem(inventory, configuration->catalog, selectedItemIndex, quantityToSell);
+                    for (std::uint32_t i = item.recipeStart; i < item.recipeStart + item.recipeCount; ++i) {
+                        const std::uint32_t ingredientIndex = configuration->catalog.recipeComponents[i].ingredientIndex;
+                        if (inventory.ingredientInventories[ingredientIndex] <= configuration->catalog.ingredients[ingredientIndex].lowInventory) {
+                            printTerminalMessage(screen, getLowInventoryWarning(configuration->catalog.ingredients[ingredientIndex]));
+                        }
                     }
 
                     // Calculate item total cost.
-                    costOfItemsSold = quantityOfHotdogsToSell * HOTDOG_PRICE;
+                    costOfItemsSold = quantityToSell * item.price;
 
                     // Increment order subtotal with item total cost.
                     orderSubtotal += costOfItemsSold;
-                } else if (sellOptionSelection == 3 && isThereChilidog) { // Chilidog
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for quantity amount.
-                        std::cout << std::endl << "Enter quantity (max " << maxQuantityOfChilidogsToSell << "): " << std::flush;
 
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
-
-                        // Validate input.
-                        quantityOfChilidogsToSell = getValidInteger(stringInput, EMPTY_INVENTORY, maxQuantityOfChilidogsToSell, 9);
-                    } while (quantityOfChilidogsToSell == -1);
-
-                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
-                    currentHotdogInventory -= quantityOfChilidogsToSell;
-                    if (currentHotdogInventory <= HOTDOG_LOW_INVENTORY) {
-                        std::cout << "Warning: Hotdog inventory low. Please restock soon." << std::endl;
+                    // Count item sold and its revenue, and export it.
+                    recordItemSale(sales, selectedItemIndex, quantityToSell, std::llround(costOfItemsSold * 100.0));
+                    if (recordSalesExportEvent(exporter, getSalesExportTime(), item.code, quantityToSell, std::llround(costOfItemsSold * 100.0)) != SALES_EXPORT_SUCCESS) {
+                        printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + " Sales will no longer be exported.\n");
                     }
-
-                    currentHotdogBunInventory -= quantityOfChilidogsToSell;
-                    if (currentHotdogBunInventory <= HOTDOG_BUN_LOW_INVENTORY) {
-                        std::cout << "Warning: Hotdog bun inventory low. Please restock soon." << std::endl;
+                } else if (sellOptionSelection == ORDER_LINE_OPTION) { // Whole order on one line
+                    // Decrement each ingredient's inventory with quantities ordered and calculate items total cost.
+                    // Count and export each item sold and its revenue.
+                    costOfItemsSold = 0;
+                    for (int i = 0; i < orderLineEntered.itemCount; ++i) {
+                        const catalogItem &orderItem = configuration->catalog.items[orderLineEntered.itemIndexes[i]];
+                        const double itemCost = orderLineEntered.itemQuantities[i] * orderItem.price;
+                        sellCatalogItem(inventory, configuration->catalog, orderLineEntered.itemIndexes[i], orderLineEntered.itemQuantities[i]);
+                        recordItemSale(sales, orderLineEntered.itemIndexes[i], orderLineEntered.itemQuantities[i], std::llround(itemCost * 100.0));
+                        if (recordSalesExportEvent(exporter, getSalesExportTime(), orderItem.code, orderLineEntered.itemQuantities[i], std::llround(itemCost * 100.0)) != SALES_EXPORT_SUCCESS) {
+                            printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + " Sales will no longer be exported.\n");
+                        }
+                        costOfItemsSold += itemCost;
                     }
 
-                    currentChiliInventory -= quantityOfChilidogsToSell * CHILI_ADDON_SERVING;
-                    if (currentChiliInventory <= CHILI_LOW_INVENTORY) {
-                        std::cout << "Warning: Chili inventory low. Please restock soon." << std::endl;
+                    // Display warning upon meeting low inventory threshold for ingredients used.
+                    for (int i = 0; i < orderLineEntered.ingredientCount; ++i) {
+                        const std::uint32_t ingredientIndex = orderLineEntered.ingredientIndexes[i];
+                        if (inventory.ingredientInventories[ingredientIndex] <= configuration->catalog.ingredients[ingredientIndex].lowInventory) {
+                            printTerminalMessage(screen, getLowInventoryWarning(configuration->catalog.ingredients[ingredientIndex]));
+                        }
                     }
 
-                    // Calculate quantity of each chili serving type available.
-                    currentChiliSelfServingsAvailable  = currentChiliInventory / CHILI_SELF_SERVING;
-                    currentChiliAddonServingsAvailable = currentChiliInventory / CHILI_ADDON_SERVING;
-
-                    // Calculate item total cost.
-                    costOfItemsSold = quantityOfChilidogsToSell * CHILIDOG_PRICE;
-
-                    // Increment order subtotal with item total cost.
+                    // Increment order subtotal with items total cost.
                     orderSubtotal += costOfItemsSold;
-                } else if (sellOptionSelection == 4 && isThereChiliSelf) { // Chili
-                    // Execute until valid integer is parsed.
-                    do {
-                        // Prompt for quantity amount.
-                        std::cout << std::endl << "Enter quantity (max " << maxQuantityOfChiliSelfToSell << "): " << std::flush;
 
-                        // Get string input.
-                        std::getline(std::cin, stringInput);
+                    // Calculate tax total.
+                    orderTax = orderSubtotal * configuration->salesTax;
+                    // Calculate order total.
+                    orderTotal = orderSubtotal + orderTax;
 
-                        // Validate input.
-                        quantityOfChiliSelfToSell = getValidInteger(stringInput, EMPTY_INVENTORY, maxQuantityOfChiliSelfToSell, 10);
-                    } while (quantityOfChiliSelfToSell == -1);
+                    // Print order total.
+                    std::stringstream orderTotalOSS;
+                    orderTotalOSS << std::endl << "Order Total: $ " << std::fixed << std::setprecision(2) << orderTotal << std::endl;
+                    printTerminalMessage(screen, orderTotalOSS.str());
 
-                    // Decrement each ingredient's inventory with quantity ordered. Display warning upon meeting low inventory threshold.
-                    currentChiliInventory -= quantityOfChiliSelfToSell * CHILI_SELF_SERVING;
-                    if (currentChiliInventory <= CHILI_LOW_INVENTORY) {
-                        std::cout << "Warning: Chili inventory low. Please restock soon." << std::endl;
+                    // Complete the order in the sales export, which writes the events held once there are enough or they are old enough.
+                    if (finishSalesExportOrder(exporter, getSalesExportTime()) != SALES_EXPORT_SUCCESS) {
+                        printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + " Sales will no longer be exported.\n");
                     }
 
-                    // Calculate quantity of each chili serving type available.
-                    currentChiliSelfServingsAvailable  = currentChiliInventory / CHILI_SELF_SERVING;
-                    currentChiliAddonServingsAvailable = currentChiliInventory / CHILI_ADDON_SERVING;
-
-                    // Calculate item total cost.
-                    costOfItemsSold = quantityOfChiliSelfToSell * CHILI_SELF_PRICE;
-
-                    // Increment order subtotal with item total cost.
-                    orderSubtotal += costOfItemsSold;
-                } else if (sellOptionSelection == 5) {
+                    // Exit loop.
+                    break;
+                } else if (sellOptionSelection == pageRowCount) { // Return
                     // Calculate tax total.
-                    orderTax= orderSubtotal * SALES_TAX;
+                    orderTax= orderSubtotal * configuration->salesTax;
                     // Calculate order total.
                     orderTotal = orderSubtotal + orderTax;
 
                     // Print order total.
                     std::stringstream orderTotalOSS;
                     orderTotalOSS << std::endl << "Order Total: $ " << std::fixed << std::setprecision(2) << orderTotal << std::endl;
-                    std::cout << orderTotalOSS.str();
+                    printTerminalMessage(screen, orderTotalOSS.str());
+
+                    // Complete the order in the sales export, which writes the events held once there are enough or they are old enough.
+                    if (finishSalesExportOrder(exporter, getSalesExportTime()) != SALES_EXPORT_SUCCESS) {
+                        printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + " Sales will no longer be exported.\n");
+                    }
 
                     // Exit loop.
                     break;
                 } else {
                     // Print message indicating there is a lack of stock for the item.
-                    std::cout << std::endl << "Invalid input, please enter an item with quantity available or update inventory." << std::endl;
+                    printTerminalMessage(screen, "\nInvalid input, please enter an item with quantity available or update inventory.\n");
                 }
-            } while (sellOptionSelection != 5);
+            } while (sellOptionSelection != pageRowCount);
         }
     }
 
+    // Print quantity sold and revenue of each item sold, and quantity of each ingredient that expired.
+    drawTerminalFrame(screen, getSalesReport(configuration->catalog, sales) + getWasteReport(configuration->catalog, inventory));
+
+    // Write order events still held to the sales export.
+    if (closeSalesExport(exporter) != SALES_EXPORT_SUCCESS) {
+        printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + "\n");
+    }
+
+    // Report bytes written to the terminal if asked to.
+    reportTerminalStatistics(screen);
+
+    // Remove inventory publication so external displays see the program has stopped.
+    removeInventoryPublication(publication, getInventoryPublicationName());
+
+    // Release configuration in use.
+    delete configuration;
+
     // Exit program successfully.
     return 0;
 }
@@ -756,29 +615,29 @@ int getLongestStringLength(const std::vector<std::string>& columnStrings) {
  * @return = stringToIntegerError enum representing the validation result from parsing string to integer
  */
 
-stringToIntegerError stringToIntegerValidation (int &parsedInteger, const char *stringInputPointer, int base) {
+stringToIntegerError stringToIntegerValidation (long long &parsedInteger, const char *stringInputPointer, int base) {
     // Error result to return
     stringToIntegerError errorResult;
     // Pointer to pointer of character past the last character interpreted
     char *end;
-    // Long to parse from string and to be cast to integer after validation
-    long longToParse;
-    // A preprocesor macro initialized to 0 for upcoming validation. In this case, it is used to determine if the long receives a value that is out of range.
+    // Long long to parse from string
+    long long longLongToParse;
+    // A preprocesor macro initialized to 0 for upcoming validation. In this case, it is used to determine if the long long receives a value that is out of range.
     errno = 0;
     // Interpret integer value from byte string pointed to by the stringInputPointer.
-    longToParse = std::strtol(stringInputPointer, &end, base);
+    longLongToParse = std::strtoll(stringInputPointer, &end, base);
 
-    // Determine if errno is out of range AND long returns LONG_MAX (the maximum value of a long) OR long exceeds INT_MAX (the maximum value of an integer). Upon error, long returns 0.
-    if ((errno == ERANGE && longToParse == LONG_MAX) || longToParse > INT_MAX) {
+    // Determine if errno is out of range AND long long returns LLONG_MAX (the maximum value of a long long). Upon error, long long returns 0.
+    if (errno == ERANGE && longLongToParse == LLONG_MAX) {
         errorResult = STRTOINT_OVERFLOW;
-    } else if ((errno == ERANGE && longToParse == LONG_MIN) || longToParse < INT_MIN) { // Determine if errno is out of range AND long returns LONG_MIN (the minimum value of a long) OR long exceeds INT_MIN (the minimum value of an integer). Upon error, long returns 0.
+    } else if (errno == ERANGE && longLongToParse == LLONG_MIN) { // Determine if errno is out of range AND long long returns LLONG_MIN (the minimum value of a long long). Upon error, long long returns 0.
         errorResult = STRTOINT_UNDERFLOW;
     } else if (*stringInputPointer == '\0' || *end != '\0') { // Determine if byte string or character pointer of last pointer returns null. Prevents input such as "5g".
         errorResult = STRTOINT_INCONVERTIBLE;
     } else { // Input is a valid integer.
         errorResult = STRTOINT_SUCCESS;
-        // Cast valid long to integer.
-        parsedInteger = static_cast<int>(longToParse);
+        // Store valid long long.
+        parsedInteger = longLongToParse;
     }
 
     // Return error result.
@@ -787,19 +646,21 @@ stringToIntegerError stringToIntegerValidation (int &parsedInteger, const char *
 
 /**
  * @brief stringToInteger takes a given string and attempts to parse and return an integer. Upon error, integer is -1.
+ * @param screen = Screen state passed by reference, used to print validation messages
  * @param stringInput = Input string to be parsed
  * @param minValue = Minimum valid integer value
  * @param maxValue = Maximum valid integer value
- * @param messageType = Message type for exceeding minimum or maximum valid integer value
+ * @param messageType = Message type for exceeding minimum or maximum valid integer value (0 default, 1 inventory, 2 quantity)
+ * @param messageName = Ingredient prompt name or item plural name used by inventory and quantity messages
  * @return = an integer parsed from the input string
  */
 
-int getValidInteger(std::string stringInput, int minValue, int maxValue, int messageType) {
+long long getValidInteger(terminalScreen &screen, std::string stringInput, long long minValue, long long maxValue, int messageType, const std::string &messageName) {
     // Convert string to c-string and then convert to constant byte string to pass to validation function.
     const char * stringInputPointer = stringInput.c_str();
 
     // Declare integer to pass by reference and to store parsed result from input string.
-    int integerFromString = -1;
+    long long integerFromString = -1;
 
     // Call validation function and store error result to enum variable.
     stringToIntegerError errorResult = stringToIntegerValidation(integerFromString, stringInputPointer);
@@ -808,60 +669,40 @@ int getValidInteger(std::string stringInput, int minValue, int maxValue, int mes
     std::stringstream exceedMaxValueOSS;
     std::stringstream exceedMinValueOSS;
 
+    // String stream for the default range message
+    std::stringstream rangeOSS;
+    rangeOSS << minValue << " and " << maxValue << ".\n";
+
     // Get exceed minimum and maximum value strings for upcoming error check.
     if (messageType == 0) { // Default
-        exceedMaxValueOSS << "Input is too high. Please enter an integer between " << minValue << " and " << maxValue << ".";
-        exceedMinValueOSS << "Input is too low. Please enter an integer between " << minValue << " and " << maxValue << ".";
-    } else if (messageType ==  1) { // Hamburger Patty Inventory
-        exceedMaxValueOSS << "Exceeded max hamburger patty capacity (" << maxValue << "). Please enter a valid inventory.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.";
-    } else if (messageType ==  2) { // Hamburger Bun Inventory
-        exceedMaxValueOSS << "Exceeded max hamburger bun capacity (" << maxValue << "). Please enter a valid inventory.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.";
-    } else if (messageType ==  3) { // Hotdog Inventory
-        exceedMaxValueOSS << "Exceeded max hotdog capacity (" << maxValue << "). Please enter a valid inventory.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.";
-    } else if (messageType ==  4) { // Hotdog Bun Inventory
-        exceedMaxValueOSS << "Exceeded max hotdog bun capacity (" << maxValue << "). Please enter a valid inventory.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.";
-    } else if (messageType ==  5) { // Chili Inventory
-        exceedMaxValueOSS << "Exceeded max chili capacity (" << maxValue << "). Please enter a valid inventory.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.";
-    } else if (messageType ==  6) { // Hamburger Quantity
-        exceedMaxValueOSS << "Exceeded quantity of hamburgers available (" << maxValue << "). Please enter a valid quantity.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.";
-    } else if (messageType ==  7) { // Chiliburger Quantity
-        exceedMaxValueOSS << "Exceeded quantity of chiliburgers available (" << maxValue << "). Please enter a valid quantity.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.";
-    } else if (messageType ==  8) { // Hotdog Quantity
-        exceedMaxValueOSS << "Exceeded quantity of hotdogs available (" << maxValue << "). Please enter a valid quantity.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.";
-    } else if (messageType ==  9) { // Chilidog Quantity
-        exceedMaxValueOSS << "Exceeded quantity of chilidogs available (" << maxValue << "). Please enter a valid quantity.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.";
-    } else if (messageType == 10) { // Chili Quantity
-        exceedMaxValueOSS << "Exceeded quantity of chili available (" << maxValue << "). Please enter a valid quantity.";
-        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.";
+        exceedMaxValueOSS << "Input is too high. Please enter an integer between " << rangeOSS.str();
+        exceedMinValueOSS << "Input is too low. Please enter an integer between " << rangeOSS.str();
+    } else if (messageType == 1) { // Ingredient Inventory
+        exceedMaxValueOSS << "Exceeded max " << messageName << " capacity (" << maxValue << "). Please enter a valid inventory.\n";
+        exceedMinValueOSS << "Invalid input. Please enter a valid inventory.\n";
+    } else if (messageType == 2) { // Item Quantity
+        exceedMaxValueOSS << "Exceeded quantity of " << messageName << " available (" << maxValue << "). Please enter a valid quantity.\n";
+        exceedMinValueOSS << "Invalid input. Please enter a valid quantity.\n";
     }
 
     // Determine error result.
     if (errorResult == STRTOINT_OVERFLOW) {
         // Print message informing user that input is too high (e.g. "99999999999999999999999999999999999999").
-        std::cout << "Input is too high. Please enter an integer between " << minValue << " and " << maxValue << "." << std::endl;
+        printTerminalPromptMessage(screen, "Input is too high. Please enter an integer between " + rangeOSS.str());
     } else if (errorResult == STRTOINT_UNDERFLOW) {
         // Print message informing user that input is too low (e.g. "-11111111111111111111111111111111111111").
-        std::cout << "Input is too low. Please enter an integer between " << minValue << " and " << maxValue << "." << std::endl;
+        printTerminalPromptMessage(screen, "Input is too low. Please enter an integer between " + rangeOSS.str());
     } else if (errorResult == STRTOINT_INCONVERTIBLE) {
         // Print message informing user that input is not a valid integer (e.g., "5g", "-5g", "9 9").
-        std::cout << "Invalid input. Please enter an integer." << std::endl;
+        printTerminalPromptMessage(screen, "Invalid input. Please enter an integer.\n");
     } else if (integerFromString > maxValue) {
         // Print message informing user that input is too high (e.g. maxValue + 1).
-        std::cout << exceedMaxValueOSS.str() << std::endl;
+        printTerminalPromptMessage(screen, exceedMaxValueOSS.str());
         // Reassign parsed integer to -1.
         integerFromString = -1;
     } else if (integerFromString < minValue) {
         // Print message informing user that input is too low (e.g. minValue - 1).
-        std::cout << exceedMinValueOSS.str() << std::endl;
+        printTerminalPromptMessage(screen, exceedMinValueOSS.str());
         // Reassign parsed integer to -1.
         integerFromString = -1;
     }
@@ -869,3 +710,302 @@ int getValidInteger(std::string stringInput, int minValue, int maxValue, int mes
     // Returns parsed integer.
     return integerFromString;
 }
+
+/**
+ * @brief pickUpTruckConfiguration picks up a reloaded configuration, carries inventory and sales over to its catalog by
+ *        code, replaces the inventory publication if the catalog's entries changed, and moves the sales export if its
+ *        path changed. Prints the error of a reloaded file that failed to parse.
+ * @param configuration = Pointer to the configuration in use passed by reference
+ * @param inventory = Current inventory passed by reference
+ * @param sales = Sales counters passed by reference
+ * @param publication = Inventory publication passed by reference
+ * @param exporter = Sales exporter passed by reference
+ * @param screen = Screen state passed by reference
+ * @return = Boolean indicating whether the configuration was replaced
+ */
+
+bool pickUpTruckConfiguration(const truckConfiguration *&configuration, catalogInventory &inventory, salesCounters &sales, inventoryPublication &publication, salesExporter &exporter, terminalScreen &screen) {
+    // Configuration replaced by the reloaded one, and error of a reloaded file that failed to parse
+    const truckConfiguration *replacedConfiguration = nullptr;
+    std::string reloadErrorMessage;
+    const bool isConfigurationReplaced = acquireTruckConfiguration(configuration, replacedConfiguration, reloadErrorMessage);
+    if (!reloadErrorMessage.empty()) {
+        printTerminalMessage(screen, reloadErrorMessage);
+    }
+    if (!isConfigurationReplaced) {
+        return false;
+    }
+
+    // Carry inventory lots over, clamped to new capacities.
+    catalogInventory transferredInventory;
+    transferCatalogInventory(transferredInventory, configuration->catalog, inventory, replacedConfiguration->catalog, std::time(nullptr));
+    inventory = std::move(transferredInventory);
+
+    // Carry sales over.
+    salesCounters transferredSales;
+    transferSalesCounters(transferredSales, configuration->catalog, sales, replacedConfiguration->catalog);
+    sales = std::move(transferredSales);
+
+    // Close the old sales export and open the new one. Events of the order in progress go to the new file.
+    if (configuration->salesExportPath != replacedConfiguration->salesExportPath) {
+        if (closeSalesExport(exporter) != SALES_EXPORT_SUCCESS) {
+            printTerminalError(screen, std::string(getSalesExportErrorMessage(SALES_EXPORT_WRITE_FAILED)) + "\n");
+        }
+        salesExportError exportResult = openSalesExport(exporter, configuration->salesExportPath.c_str());
+        if (exportResult != SALES_EXPORT_SUCCESS) {
+            printTerminalError(screen, std::string(getSalesExportErrorMessage(exportResult)) + " Sales will not be exported.\n");
+        }
+    }
+    delete replacedConfiguration;
+
+    // Keep publishing into the segment while the catalog's entries are unchanged, so readers keep their mapping. Otherwise
+    // retire it so readers reopen the new layout.
+    if (isInventoryPublicationForCatalog(publication, configuration->catalog)) {
+        return true;
+    }
+    removeInventoryPublication(publication, getInventoryPublicationName());
+    publicationError publicationResult = createInventoryPublication(publication, getInventoryPublicationName(), configuration->catalog);
+    if (publicationResult == PUBLICATION_IN_USE) {
+        printTerminalError(screen, "Inventory is already published by another running program. External displays will not be updated.\n");
+    } else if (publicationResult != PUBLICATION_SUCCESS) {
+        printTerminalError(screen, "Inventory publication unavailable. External displays will not be updated.\n");
+    }
+
+    return true;
+}
+
+/**
+ * @brief refreshTruckState prepares the truck for the next screen: it picks up a reloaded configuration, removes
+ *        expired stock, and publishes inventory changed since the last screen for external displays.
+ * @param configuration = Pointer to the configuration in use passed by reference
+ * @param inventory = Current inventory passed by reference
+ * @param sales = Sales counters passed by reference
+ * @param publication = Inventory publication passed by reference
+ * @param exporter = Sales exporter passed by reference
+ * @param screen = Screen state passed by reference
+ * @return = Boolean indicating whether the configuration was replaced
+ */
+
+bool refreshTruckState(const truckConfiguration *&configuration, catalogInventory &inventory, salesCounters &sales, inventoryPublication &publication, salesExporter &exporter, terminalScreen &screen) {
+    const bool isConfigurationReplaced = pickUpTruckConfiguration(configuration, inventory, sales, publication, exporter, screen);
+    if (isConfigurationReplaced) {
+        printTerminalMessage(screen, "\nConfiguration updated.\n");
+    }
+
+    expireTruckInventory(configuration->catalog, inventory, screen);
+
+    publishCatalogInventory(publication, inventory, getSalesRevenueCents(sales));
+    clearCatalogInventoryChanges(inventory);
+
+    return isConfigurationReplaced;
+}
+
+/**
+ * @brief expireTruckInventory removes stock past its expiry time so it is never sold, and warns about it.
+ * @param catalog = Catalog in use
+ * @param inventory = Current inventory passed by reference
+ * @param screen = Screen state passed by reference
+ */
+
+void expireTruckInventory(const truckCatalog &catalog, catalogInventory &inventory, terminalScreen &screen) {
+    // Quantity of each ingredient removed by the sweep
+    std::vector<catalogExpiredStock> expiredStock;
+    expireCatalogInventory(inventory, catalog, std::time(nullptr), expiredStock);
+    for (unsigned int i = 0; i < expiredStock.size(); ++i) {
+        printTerminalMessage(screen, getExpiredStockWarning(catalog.ingredients[expiredStock[i].ingredientIndex], expiredStock[i].quantity));
+    }
+}
+
+/**
+ * @brief handleMenuPageCommand applies a page or filter command entered at a table prompt: "n" for the next page, "p"
+ *        for the previous page, "/text" to list only entries whose code or label contains the text, and "/" alone to
+ *        list everything again.
+ * @param stringInput = Input string
+ * @param page = Page of the table shown passed by reference
+ * @param filterText = Filter of the table passed by reference
+ * @return = Boolean indicating whether the input was a page or filter command
+ */
+
+bool handleMenuPageCommand(const std::string &stringInput, unsigned int &page, std::string &filterText) {
+    if (stringInput == "n" || stringInput == "N") {
+        // Move to next page. The caller clamps it to the last page.
+        ++page;
+    } else if (stringInput == "p" || stringInput == "P") {
+        // Move to previous page.
+        if (page > 0) {
+            --page;
+        }
+    } else if (!stringInput.empty() && stringInput[0] == '/') {
+        // Replace filter and start from the first page.
+        filterText = stringInput.substr(1);
+        page = 0;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief getMenuPageHint returns lines describing the page shown and the page commands, kept short enough for an
+ *        80-column terminal, or an empty string when the whole unfiltered table fits on one page.
+ * @param page = Page of the table shown
+ * @param pageCount = Number of pages in the table
+ * @param visibleCount = Number of entries matching the filter
+ * @param filterText = Filter of the table
+ * @return = String with hint
+ */
+
+std::string getMenuPageHint(unsigned int page, unsigned int pageCount, unsigned int visibleCount, const std::string &filterText) {
+    if (pageCount == 1 && filterText.empty()) {
+        return "";
+    }
+
+    std::stringstream pageHintOSS;
+    pageHintOSS << "Page " << page + 1 << " of " << pageCount << " (" << visibleCount << " listed";
+    if (!filterText.empty()) {
+        pageHintOSS << " matching \"" << filterText << "\"";
+    }
+    pageHintOSS << ")." << std::endl << "Enter n or p to change page, /text to filter, / to clear filter, or a code." << std::endl << std::endl;
+
+    return pageHintOSS.str();
+}
+
+/**
+ * @brief getLowInventoryWarning returns the warning printed when an ingredient meets its low inventory threshold.
+ * @param ingredient = Ingredient low on inventory
+ * @return = String with warning
+ */
+
+std::string getLowInventoryWarning(const catalogIngredient &ingredient) {
+    std::string ingredientName = ingredient.promptName;
+    if (!ingredientName.empty()) {
+        ingredientName[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(ingredientName[0])));
+    }
+
+    return "Warning: " + ingredientName + " inventory low. Please restock soon.\n";
+}
+
+/**
+ * @brief getSalesReport merges sales counters into a table of quantity sold and revenue for each item sold, followed
+ *        by totals.
+ * @param catalog = Catalog the counters belong to
+ * @param sales = Sales counters
+ * @return = String with formatted table
+ */
+
+std::string getSalesReport(const truckCatalog &catalog, const salesCounters &sales) {
+    // Quantity sold and revenue of each item
+    std::vector<std::int64_t> quantitiesSold;
+    std::vector<std::int64_t> revenuesCents;
+    mergeSalesCounters(quantitiesSold, revenuesCents, sales);
+
+    // Vector of strings for report columns to use to determine dynamic padding
+    std::vector<std::string> reportItemColumn          = { "Item" };
+    std::vector<std::string> reportQuantitySoldColumn  = { "Quantity Sold" };
+    std::vector<std::string> reportRevenueColumn       = { "Revenue" };
+    std::int64_t totalQuantitySold = 0;
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        if (quantitiesSold[i] > 0) {
+            std::stringstream itemRevenueOSS;
+            itemRevenueOSS << "$ " << std::fixed << std::setprecision(2) << revenuesCents[i] / 100.0;
+
+            reportItemColumn.push_back(catalog.items[i].label);
+            reportQuantitySoldColumn.push_back(std::to_string(quantitiesSold[i]));
+            reportRevenueColumn.push_back(itemRevenueOSS.str());
+            totalQuantitySold += quantitiesSold[i];
+        }
+    }
+
+    // Totals come from the shard totals, which also keep sales of items removed by a reloaded catalog.
+    std::stringstream totalRevenueOSS;
+    totalRevenueOSS << "$ " << std::fixed << std::setprecision(2) << getSalesRevenueCents(sales) / 100.0;
+    reportItemColumn.push_back("Total");
+    reportQuantitySoldColumn.push_back(std::to_string(totalQuantitySold));
+    reportRevenueColumn.push_back(totalRevenueOSS.str());
+
+    // Lengths of each width for padding
+    const int REPORT_ITEM_WIDTH          = getLongestStringLength(reportItemColumn);
+    const int REPORT_QUANTITY_SOLD_WIDTH = getLongestStringLength(reportQuantitySoldColumn) + 4;
+    const int REPORT_REVENUE_WIDTH       = getLongestStringLength(reportRevenueColumn) + 4;
+
+    // Print formatted table.
+    std::stringstream reportOSS;
+    reportOSS << std::endl << "Sales Report" << std::endl << std::endl;
+    for (unsigned int i = 0; i < reportItemColumn.size(); ++i) {
+        reportOSS << std::left << std::setw(REPORT_ITEM_WIDTH) << reportItemColumn.at(i) << std::right << std::setw(REPORT_QUANTITY_SOLD_WIDTH) << reportQuantitySoldColumn.at(i) << std::setw(REPORT_REVENUE_WIDTH) << reportRevenueColumn.at(i) << std::endl;
+    }
+
+    return reportOSS.str();
+}
+
+/**
+ * @brief getExpiredStockWarning returns the warning printed when stock of an ingredient expires and is removed.
+ * @param ingredient = Ingredient that expired
+ * @param quantityExpired = Quantity removed
+ * @return = String with warning
+ */
+
+std::string getExpiredStockWarning(const catalogIngredient &ingredient, std::int64_t quantityExpired) {
+    std::string ingredientName = ingredient.promptName;
+    if (!ingredientName.empty()) {
+        ingredientName[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(ingredientName[0])));
+    }
+
+    return "\nWarning: " + ingredientName + " expired (" + std::to_string(quantityExpired) + (ingredient.unit.empty() ? "" : " " + ingredient.unit) + " removed). Please restock soon.\n";
+}
+
+/**
+ * @brief getTimeUntilExpiry formats the time left before stock expires as hours and minutes, rounded up.
+ * @param expiryTime = Expiry time in seconds since the epoch, or LOT_NEVER_EXPIRES
+ * @param currentTime = Current time in seconds since the epoch
+ * @return = String with time left (e.g. "3h 05m"), or "-" if the stock never expires
+ */
+
+std::string getTimeUntilExpiry(std::int64_t expiryTime, std::int64_t currentTime) {
+    if (expiryTime == LOT_NEVER_EXPIRES) {
+        return "-";
+    }
+
+    const std::int64_t minutesLeft = expiryTime > currentTime ? (expiryTime - currentTime + 59) / 60 : 0;
+    std::stringstream timeLeftOSS;
+    timeLeftOSS << minutesLeft / 60 << "h " << std::setfill('0') << std::setw(2) << minutesLeft % 60 << "m";
+
+    return timeLeftOSS.str();
+}
+
+/**
+ * @brief getWasteReport returns a table of the quantity of each ingredient that expired, or an empty string when
+ *        nothing expired.
+ * @param catalog = Catalog the inventory belongs to
+ * @param inventory = Current inventory
+ * @return = String with formatted table
+ */
+
+std::string getWasteReport(const truckCatalog &catalog, const catalogInventory &inventory) {
+    // Vector of strings for report columns to use to determine dynamic padding
+    std::vector<std::string> reportIngredientColumn = { "Ingredient" };
+    std::vector<std::string> reportExpiredColumn    = { "Expired" };
+    for (std::uint32_t i = 0; i < catalog.ingredients.size(); ++i) {
+        if (inventory.ingredientExpired[i] > 0) {
+            reportIngredientColumn.push_back(catalog.ingredients[i].label);
+            reportExpiredColumn.push_back(std::to_string(inventory.ingredientExpired[i]) + (catalog.ingredients[i].unit.empty() ? "" : " " + catalog.ingredients[i].unit));
+        }
+    }
+    if (reportIngredientColumn.size() == 1) {
+        return "";
+    }
+
+    // Lengths of each width for padding
+    const int REPORT_INGREDIENT_WIDTH = getLongestStringLength(reportIngredientColumn);
+    const int REPORT_EXPIRED_WIDTH    = getLongestStringLength(reportExpiredColumn) + 4;
+
+    // Print formatted table.
+    std::stringstream reportOSS;
+    reportOSS << std::endl << "Waste Report" << std::endl << std::endl;
+    for (unsigned int i = 0; i < reportIngredientColumn.size(); ++i) {
+        reportOSS << std::left << std::setw(REPORT_INGREDIENT_WIDTH) << reportIngredientColumn.at(i) << std::right << std::setw(REPORT_EXPIRED_WIDTH) << reportExpiredColumn.at(i) << std::endl;
+    }
+
+    return reportOSS.str();
+}
@@ -0,0 +1,239 @@
+//================================================================================
+// Name        : sales_counters.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Per-item quantity sold and revenue kept in cache-line-padded
+//               per-thread shards and merged only when read
+//================================================================================
+
+#include "sales_counters.h"
+
+#include <utility>
+
+// Counters per cache line, and fields before the first item in each shard
+static const std::size_t COUNTERS_PER_CACHE_LINE = 64 / sizeof(std::atomic<std::int64_t>);
+static const std::size_t SHARD_TOTAL_FIELD_COUNT = 2;
+
+// Shard written by every thread claiming after the owned shards run out, and the number of shards allocated
+static const unsigned int SHARED_SHARD_INDEX = SALES_COUNTER_SHARD_COUNT;
+static const unsigned int ALLOCATED_SHARD_COUNT = SALES_COUNTER_SHARD_COUNT + 1;
+
+static_assert(SALES_COUNTER_SHARD_COUNT <= 32, "Shard claims are bits of a 32-bit word.");
+
+// Shard the calling thread claimed in one set of counters (SHARED_SHARD_INDEX once every owned shard was claimed)
+struct threadShardClaim {
+    std::shared_ptr<salesCounterClaims> claims;
+    unsigned int shardIndex;
+};
+
+// Shards claimed by the calling thread, most recently used last. Its destructor runs when the thread exits.
+struct threadShardClaimGuard {
+    std::vector<threadShardClaim> shardClaims;
+    ~threadShardClaimGuard();
+};
+
+static thread_local threadShardClaimGuard threadSalesCounterClaims;
+
+static unsigned int claimSalesCounterShard(const salesCounters &counters);
+static void releaseSalesCounterShard(const threadShardClaim &shardClaim);
+static void addToSalesCounter(std::atomic<std::int64_t> &counter, std::int64_t value, bool isShardOwned);
+
+/**
+ * @brief initializeSalesCounters allocates zeroed shards for a number of items.
+ * @param counters = Counters to initialize passed by reference
+ * @param itemCount = Number of items in the catalog
+ */
+
+void initializeSalesCounters(salesCounters &counters, std::uint32_t itemCount) {
+    counters.itemCount = itemCount;
+    counters.shardStride = (SHARD_TOTAL_FIELD_COUNT + 2 * static_cast<std::size_t>(itemCount) + COUNTERS_PER_CACHE_LINE - 1) / COUNTERS_PER_CACHE_LINE * COUNTERS_PER_CACHE_LINE;
+
+    // Allocate a spare cache line so the first shard can start on a cache line boundary.
+    counters.storage = std::vector<std::atomic<std::int64_t>>(ALLOCATED_SHARD_COUNT * counters.shardStride + COUNTERS_PER_CACHE_LINE - 1);
+    for (std::size_t i = 0; i < counters.storage.size(); ++i) {
+        counters.storage[i].store(0, std::memory_order_relaxed);
+    }
+
+    std::size_t firstCounter = 0;
+    while (reinterpret_cast<std::uintptr_t>(&counters.storage[firstCounter]) % 64 != 0) {
+        ++firstCounter;
+    }
+    counters.shards = &counters.storage[firstCounter];
+
+    counters.claims = std::make_shared<salesCounterClaims>();
+    counters.claims->claimedShards.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief transferSalesCounters carries sales over to a new catalog by item code. Sales of items no longer in the
+ *        catalog stay in the totals.
+ * @param newCounters = Counters for the new catalog passed by reference
+ * @param newCatalog = New catalog
+ * @param oldCounters = Counters for the old catalog
+ * @param oldCatalog = Old catalog
+ */
+
+void transferSalesCounters(salesCounters &newCounters, const truckCatalog &newCatalog, const salesCounters &oldCounters, const truckCatalog &oldCatalog) {
+    initializeSalesCounters(newCounters, static_cast<std::uint32_t>(newCatalog.items.size()));
+
+    std::vector<std::int64_t> quantitiesSold;
+    std::vector<std::int64_t> revenuesCents;
+    mergeSalesCounters(quantitiesSold, revenuesCents, oldCounters);
+
+    // Totals of items that carry over are added back with those items.
+    std::int64_t unmatchedQuantity = 0;
+    std::int64_t unmatchedRevenueCents = 0;
+    for (std::uint32_t i = 0; i < oldCatalog.items.size(); ++i) {
+        std::int32_t newItemIndex = findCatalogItem(newCatalog, oldCatalog.items[i].code.c_str());
+        if (newItemIndex >= 0) {
+            recordItemSale(newCounters, static_cast<std::uint32_t>(newItemIndex), quantitiesSold[i], revenuesCents[i]);
+        } else {
+            unmatchedQuantity += quantitiesSold[i];
+            unmatchedRevenueCents += revenuesCents[i];
+        }
+    }
+
+    std::atomic<std::int64_t> *sharedShard = newCounters.shards + SHARED_SHARD_INDEX * newCounters.shardStride;
+    addToSalesCounter(sharedShard[0], unmatchedQuantity, false);
+    addToSalesCounter(sharedShard[1], unmatchedRevenueCents, false);
+}
+
+/**
+ * @brief recordItemSale adds a sale to the calling thread's shard, or to the shared shard once every shard is claimed.
+ *        The first call on a thread for these counters claims its shard, which it keeps until it exits.
+ * @param counters = Counters passed by reference
+ * @param itemIndex = Index of item sold
+ * @param quantity = Quantity sold
+ * @param revenueCents = Revenue from the sale in cents, before tax
+ */
+
+void recordItemSale(salesCounters &counters, std::uint32_t itemIndex, std::int64_t quantity, std::int64_t revenueCents) {
+    std::vector<threadShardClaim> &shardClaims = threadSalesCounterClaims.shardClaims;
+    const unsigned int shardIndex = !shardClaims.empty() && shardClaims.back().claims == counters.claims ? shardClaims.back().shardIndex : claimSalesCounterShard(counters);
+
+    // Only threads holding a claim own a shard outright. Other threads never touch an owned shard, since its owner's
+    // plain load and store would overwrite their additions.
+    const bool isShardOwned = shardIndex != SHARED_SHARD_INDEX;
+    std::atomic<std::int64_t> *shard = counters.shards + shardIndex * counters.shardStride;
+
+    addToSalesCounter(shard[0], quantity, isShardOwned);
+    addToSalesCounter(shard[1], revenueCents, isShardOwned);
+    addToSalesCounter(shard[SHARD_TOTAL_FIELD_COUNT + 2 * itemIndex], quantity, isShardOwned);
+    addToSalesCounter(shard[SHARD_TOTAL_FIELD_COUNT + 2 * itemIndex + 1], revenueCents, isShardOwned);
+}
+
+/**
+ * @brief getSalesRevenueCents merges only the shard totals, so it is cheap enough to call on every screen.
+ * @param counters = Counters
+ * @return = Revenue from all items sold in cents, before tax
+ */
+
+std::int64_t getSalesRevenueCents(const salesCounters &counters) {
+    std::int64_t revenueCents = 0;
+    for (unsigned int i = 0; i < ALLOCATED_SHARD_COUNT; ++i) {
+        revenueCents += counters.shards[i * counters.shardStride + 1].load(std::memory_order_relaxed);
+    }
+
+    return revenueCents;
+}
+
+/**
+ * @brief mergeSalesCounters adds up every shard into quantity sold and revenue for each item. Meant for reports and
+ *        screens that show per-item sales, not for every sale.
+ * @param quantitiesSold = Vector to receive quantity sold of each item passed by reference
+ * @param revenuesCents = Vector to receive revenue of each item in cents passed by reference
+ * @param counters = Counters
+ */
+
+void mergeSalesCounters(std::vector<std::int64_t> &quantitiesSold, std::vector<std::int64_t> &revenuesCents, const salesCounters &counters) {
+    quantitiesSold.assign(counters.itemCount, 0);
+    revenuesCents.assign(counters.itemCount, 0);
+
+    for (unsigned int i = 0; i < ALLOCATED_SHARD_COUNT; ++i) {
+        const std::atomic<std::int64_t> *itemFields = counters.shards + i * counters.shardStride + SHARD_TOTAL_FIELD_COUNT;
+        for (std::uint32_t j = 0; j < counters.itemCount; ++j) {
+            quantitiesSold[j] += itemFields[2 * j].load(std::memory_order_relaxed);
+            revenuesCents[j] += itemFields[2 * j + 1].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief claimSalesCounterShard finds the calling thread's claim on a set of counters, or claims the lowest free owned
+ *        shard, or the shared shard if none is free. Claims on counters that no longer exist are dropped on the way.
+ * @param counters = Counters
+ * @return = Index of the shard to add to
+ */
+
+static unsigned int claimSalesCounterShard(const salesCounters &counters) {
+    std::vector<threadShardClaim> &shardClaims = threadSalesCounterClaims.shardClaims;
+    for (std::size_t i = 0; i < shardClaims.size(); ) {
+        if (shardClaims[i].claims == counters.claims) {
+            // Move to the end, where the next sale looks first.
+            std::swap(shardClaims[i], shardClaims.back());
+            return shardClaims.back().shardIndex;
+        } else if (shardClaims[i].claims.use_count() == 1) {
+            std::swap(shardClaims[i], shardClaims.back());
+            shardClaims.pop_back();
+        } else {
+            ++i;
+        }
+    }
+
+    // Acquire what the shard's previous owner added before releasing it, since this thread adds without locking.
+    threadShardClaim shardClaim = { counters.claims, SHARED_SHARD_INDEX };
+    std::uint32_t claimedShards = counters.claims->claimedShards.load(std::memory_order_relaxed);
+    for (;;) {
+        unsigned int freeShard = 0;
+        while (freeShard < SALES_COUNTER_SHARD_COUNT && (claimedShards & (1u << freeShard)) != 0) {
+            ++freeShard;
+        }
+        if (freeShard == SALES_COUNTER_SHARD_COUNT) {
+            break;
+        } else if (counters.claims->claimedShards.compare_exchange_weak(claimedShards, claimedShards | (1u << freeShard), std::memory_order_acquire, std::memory_order_relaxed)) {
+            shardClaim.shardIndex = freeShard;
+            break;
+        }
+    }
+    shardClaims.push_back(shardClaim);
+
+    return shardClaim.shardIndex;
+}
+
+/**
+ * @brief releaseSalesCounterShard gives a claimed shard back. Everything the thread added is released along with it.
+ * @param shardClaim = Claim to release
+ */
+
+static void releaseSalesCounterShard(const threadShardClaim &shardClaim) {
+    if (shardClaim.shardIndex != SHARED_SHARD_INDEX) {
+        shardClaim.claims->claimedShards.fetch_and(~(1u << shardClaim.shardIndex), std::memory_order_release);
+    }
+}
+
+/**
+ * @brief ~threadShardClaimGuard releases the shards the exiting thread claimed.
+ */
+
+threadShardClaimGuard::~threadShardClaimGuard() {
+    for (std::size_t i = 0; i < shardClaims.size(); ++i) {
+        releaseSalesCounterShard(shardClaims[i]);
+    }
+}
+
+/**
+ * @brief addToSalesCounter adds to a counter. An owned shard has a single writer, so a relaxed load and store suffice
+ *        and no locked instruction is issued; readers still see whole values.
+ * @param counter = Counter passed by reference
+ * @param value = Value to add
+ * @param isShardOwned = Boolean indicating whether the calling thread is the shard's only writer
+ */
+
+static void addToSalesCounter(std::atomic<std::int64_t> &counter, std::int64_t value, bool isShardOwned) {
+    if (isShardOwned) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    } else {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,49 @@
+//================================================================================
+// Name        : sales_counters.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Per-item quantity sold and revenue kept in cache-line-padded
+//               per-thread shards and merged only when read
+//================================================================================
+
+#ifndef SALES_COUNTERS_H
+#define SALES_COUNTERS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "catalog.h"
+
+// Number of shards owned by one selling thread each. Threads beyond this all share one more shard.
+const unsigned int SALES_COUNTER_SHARD_COUNT = 16;
+
+// Owned shards of one set of counters claimed by selling threads, one bit per shard. Shared with each claiming thread,
+// so a thread exiting can give its shard back even after the counters are gone.
+struct salesCounterClaims {
+    std::atomic<std::uint32_t> claimedShards;
+};
+
+// Counters of every item, one shard per selling thread plus the shared shard last. A shard holds the total quantity
+// and revenue followed by the quantity and revenue of each item, and starts on its own cache line with its size rounded
+// up to whole cache lines, so threads never write the same line. A thread owning its shard is its only writer and adds
+// with a plain load and store; the shared shard only ever uses atomic read-modify-write. Readers merge shards on
+// demand. A thread claims a shard of each set of counters it sells into and releases it when it exits.
+struct salesCounters {
+    std::vector<std::atomic<std::int64_t>> storage;
+    std::atomic<std::int64_t> *shards;
+    std::size_t shardStride;
+    std::uint32_t itemCount;
+    std::shared_ptr<salesCounterClaims> claims;
+};
+
+void initializeSalesCounters(salesCounters &counters, std::uint32_t itemCount);
+void transferSalesCounters(salesCounters &newCounters, const truckCatalog &newCatalog, const salesCounters &oldCounters, const truckCatalog &oldCatalog);
+void recordItemSale(salesCounters &counters, std::uint32_t itemIndex, std::int64_t quantity, std::int64_t revenueCents);
+std::int64_t getSalesRevenueCents(const salesCounters &counters);
+void mergeSalesCounters(std::vector<std::int64_t> &quantitiesSold, std::vector<std::int64_t> &revenuesCents, const salesCounters &counters);
+
+#endif // SALES_COUNTERS_H
@@ -0,0 +1,606 @@
+//================================================================================
+// Name        : sales_export.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Streaming export of order events to a compact column-wise
+//               binary file for upload, and the matching streaming reader
+//================================================================================
+
+#include "sales_export.h"
+
+#include <chrono>
+#include <cstring>
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+// Bytes around each block payload: magic and payload length before it, checksum after it
+static const std::size_t SALES_EXPORT_BLOCK_HEADER_SIZE  = 8;
+static const std::size_t SALES_EXPORT_BLOCK_TRAILER_SIZE = 4;
+
+static salesExportError writeSalesExportBlock(salesExporter &exporter);
+static std::size_t encodeSalesExportBlock(unsigned char *payload, const salesExportBlock &block);
+static bool decodeSalesExportBlock(salesExportBlock &block, const unsigned char *payload, std::size_t payloadSize);
+static salesExportError readSalesExportBlock(salesExportReader &reader);
+static unsigned char *writeVarint(unsigned char *output, std::uint64_t value);
+static bool readVarint(const unsigned char *&input, const unsigned char *inputEnd, std::uint64_t &value);
+static std::uint64_t encodeZigzag(std::int64_t value);
+static std::int64_t decodeZigzag(std::uint64_t value);
+static void writeLittleEndian32(unsigned char *output, std::uint32_t value);
+static std::uint32_t readLittleEndian32(const unsigned char *input);
+static std::uint32_t hashSalesExportPayload(const unsigned char *payload, std::size_t payloadSize);
+static void clearSalesExportBlock(salesExporter &exporter);
+
+/**
+ * @brief openSalesExport opens an export file for appending. An existing export file resumes after its last whole
+ *        block, dropping any block cut off by a crash, and continues its order numbers. An empty path turns exporting
+ *        off, and recorded events are then ignored.
+ * @param exporter = Exporter to open passed by reference
+ * @param exportPath = Path of export file
+ * @return = salesExportError enum representing the result of opening the file
+ */
+
+salesExportError openSalesExport(salesExporter &exporter, const char *exportPath) {
+    exporter.file = nullptr;
+    clearSalesExportBlock(exporter);
+    exporter.orderNumber = 0;
+    exporter.isOrderStarted = false;
+
+    if (*exportPath == '\0') {
+        return SALES_EXPORT_SUCCESS;
+    }
+
+    // Determine if the file exists and has anything in it.
+    long existingSize = 0;
+    std::FILE *existingFile = std::fopen(exportPath, "rb");
+    if (existingFile != nullptr) {
+        if (std::fseek(existingFile, 0, SEEK_END) == 0) {
+            existingSize = std::ftell(existingFile);
+        }
+        std::fclose(existingFile);
+    }
+
+    // Read through existing blocks for where the last one ends and the last order number.
+    long resumeOffset = 0;
+    if (existingSize > 0) {
+        salesExportReader *reader = new salesExportReader;
+        salesExportError readResult = openSalesExportReader(*reader, exportPath, 0);
+        if (readResult == SALES_EXPORT_SUCCESS) {
+            salesExportEvent event;
+            while (readSalesExportEvent(*reader, event) == SALES_EXPORT_SUCCESS) {
+                exporter.orderNumber = event.orderNumber;
+            }
+            resumeOffset = reader->blockEndOffset;
+            closeSalesExportReader(*reader);
+        }
+        delete reader;
+
+        if (readResult != SALES_EXPORT_SUCCESS) {
+            return readResult;
+        }
+    }
+
+    if (resumeOffset > 0) {
+#ifdef __unix__
+        // Drop a partly written block so new blocks follow the last whole one.
+        if (resumeOffset < existingSize && truncate(exportPath, resumeOffset) != 0) {
+            return SALES_EXPORT_WRITE_FAILED;
+        }
+#endif
+        exporter.file = std::fopen(exportPath, "r+b");
+        if (exporter.file == nullptr || std::fseek(exporter.file, resumeOffset, SEEK_SET) != 0) {
+            closeSalesExport(exporter);
+            return SALES_EXPORT_UNOPENABLE;
+        }
+    } else {
+        exporter.file = std::fopen(exportPath, "wb");
+        if (exporter.file == nullptr) {
+            return SALES_EXPORT_UNOPENABLE;
+        }
+
+        unsigned char fileHeader[SALES_EXPORT_FILE_HEADER_SIZE];
+        writeLittleEndian32(fileHeader, SALES_EXPORT_FILE_MAGIC);
+        writeLittleEndian32(fileHeader + 4, SALES_EXPORT_FILE_VERSION);
+        if (std::fwrite(fileHeader, 1, sizeof(fileHeader), exporter.file) != sizeof(fileHeader) || std::fflush(exporter.file) != 0) {
+            std::fclose(exporter.file);
+            exporter.file = nullptr;
+            return SALES_EXPORT_WRITE_FAILED;
+        }
+    }
+
+    return SALES_EXPORT_SUCCESS;
+}
+
+/**
+ * @brief startSalesExportOrder starts a new order. Its number is taken by its first event, so orders without sales
+ *        leave no gap.
+ * @param exporter = Exporter passed by reference
+ */
+
+void startSalesExportOrder(salesExporter &exporter) {
+    exporter.isOrderStarted = false;
+}
+
+/**
+ * @brief recordSalesExportEvent adds an item line of the current order to the block being filled, and writes the
+ *        block once it is full.
+ * @param exporter = Exporter passed by reference
+ * @param timeMilliseconds = Time of sale in milliseconds since the epoch
+ * @param itemCode = Code of item sold
+ * @param quantity = Quantity sold
+ * @param revenueCents = Revenue from the sale in cents, before tax
+ * @return = salesExportError enum representing the result of recording the event
+ */
+
+salesExportError recordSalesExportEvent(salesExporter &exporter, std::int64_t timeMilliseconds, const std::string &itemCode, std::int64_t quantity, std::int64_t revenueCents) {
+    if (exporter.file == nullptr) {
+        return SALES_EXPORT_SUCCESS;
+    }
+
+    if (!exporter.isOrderStarted) {
+        ++exporter.orderNumber;
+        exporter.isOrderStarted = true;
+    }
+
+    // Look up item code in the block's dictionary, adding it on first use. The table is twice the most codes a block
+    // can hold, so probing always ends at the code or an empty slot.
+    salesExportBlock &block = exporter.block;
+    const std::uint32_t slotMask = 2 * SALES_EXPORT_BLOCK_EVENTS - 1;
+    std::uint32_t slot = hashSalesExportPayload(reinterpret_cast<const unsigned char *>(itemCode.c_str()), itemCode.size()) & slotMask;
+    while (exporter.itemCodeSlots[slot] != 0 && std::strcmp(block.itemCodes[exporter.itemCodeSlots[slot] - 1], itemCode.c_str()) != 0) {
+        slot = (slot + 1) & slotMask;
+    }
+    if (exporter.itemCodeSlots[slot] == 0) {
+        std::strncpy(block.itemCodes[block.itemCodeCount], itemCode.c_str(), MAX_CATALOG_CODE_LENGTH);
+        block.itemCodes[block.itemCodeCount][MAX_CATALOG_CODE_LENGTH] = '\0';
+        exporter.itemCodeSlots[slot] = static_cast<std::uint16_t>(++block.itemCodeCount);
+    }
+    const std::uint32_t itemId = exporter.itemCodeSlots[slot] - 1u;
+
+    block.timesMilliseconds[block.eventCount] = timeMilliseconds;
+    block.orderNumbers[block.eventCount]      = exporter.orderNumber;
+    block.itemIds[block.eventCount]           = itemId;
+    block.quantities[block.eventCount]        = quantity;
+    block.revenuesCents[block.eventCount]     = revenueCents;
+    ++block.eventCount;
+
+    if (block.eventCount == SALES_EXPORT_BLOCK_EVENTS) {
+        return writeSalesExportBlock(exporter);
+    }
+
+    return SALES_EXPORT_SUCCESS;
+}
+
+/**
+ * @brief finishSalesExportOrder completes the current order. The events held are written, ending the block early, once
+ *        they number SALES_EXPORT_FLUSH_EVENTS or the first is SALES_EXPORT_FLUSH_MILLISECONDS old, so a program killed
+ *        before it quits loses only the orders held since.
+ * @param exporter = Exporter passed by reference
+ * @param timeMilliseconds = Time the order was completed in milliseconds since the epoch
+ * @return = salesExportError enum representing the result of writing the block
+ */
+
+salesExportError finishSalesExportOrder(salesExporter &exporter, std::int64_t timeMilliseconds) {
+    const salesExportBlock &block = exporter.block;
+    if (exporter.file == nullptr || block.eventCount == 0 || (block.eventCount < SALES_EXPORT_FLUSH_EVENTS && timeMilliseconds - block.timesMilliseconds[0] < SALES_EXPORT_FLUSH_MILLISECONDS)) {
+        return SALES_EXPORT_SUCCESS;
+    }
+
+    return writeSalesExportBlock(exporter);
+}
+
+/**
+ * @brief closeSalesExport writes the events still held and closes the export file.
+ * @param exporter = Exporter to close passed by reference
+ * @return = salesExportError enum representing the result of writing the last block
+ */
+
+salesExportError closeSalesExport(salesExporter &exporter) {
+    salesExportError errorResult = SALES_EXPORT_SUCCESS;
+
+    if (exporter.file != nullptr && exporter.block.eventCount > 0) {
+        errorResult = writeSalesExportBlock(exporter);
+    }
+    if (exporter.file != nullptr) {
+        std::fclose(exporter.file);
+        exporter.file = nullptr;
+    }
+
+    return errorResult;
+}
+
+/**
+ * @brief getSalesExportTime returns the current time for an export event.
+ * @return = Milliseconds since the epoch
+ */
+
+std::int64_t getSalesExportTime() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief openSalesExportReader opens an export file for reading from a byte offset. The offset need not be a block
+ *        boundary; reading starts at the next whole block after it.
+ * @param reader = Reader to open passed by reference
+ * @param exportPath = Path of export file
+ * @param startOffset = Byte offset to start at (0 for the whole file, or a blockEndOffset saved earlier)
+ * @return = salesExportError enum representing the result of opening the file
+ */
+
+salesExportError openSalesExportReader(salesExportReader &reader, const char *exportPath, long startOffset) {
+    reader.block.eventCount = 0;
+    reader.block.itemCodeCount = 0;
+    reader.nextEvent = 0;
+
+    reader.file = std::fopen(exportPath, "rb");
+    if (reader.file == nullptr) {
+        return SALES_EXPORT_UNOPENABLE;
+    }
+
+    // Check file header wherever reading starts.
+    unsigned char fileHeader[SALES_EXPORT_FILE_HEADER_SIZE];
+    if (std::fread(fileHeader, 1, sizeof(fileHeader), reader.file) != sizeof(fileHeader) || readLittleEndian32(fileHeader) != SALES_EXPORT_FILE_MAGIC || readLittleEndian32(fileHeader + 4) != SALES_EXPORT_FILE_VERSION) {
+        closeSalesExportReader(reader);
+        return SALES_EXPORT_NOT_EXPORT_FILE;
+    }
+
+    reader.blockEndOffset = startOffset > SALES_EXPORT_FILE_HEADER_SIZE ? startOffset : SALES_EXPORT_FILE_HEADER_SIZE;
+    if (std::fseek(reader.file, reader.blockEndOffset, SEEK_SET) != 0) {
+        closeSalesExportReader(reader);
+        return SALES_EXPORT_UNOPENABLE;
+    }
+
+    return SALES_EXPORT_SUCCESS;
+}
+
+/**
+ * @brief readSalesExportEvent reads the next event, reading the next block when the current one is used up.
+ * @param reader = Reader passed by reference
+ * @param event = Event to receive the next event passed by reference
+ * @return = salesExportError enum, SALES_EXPORT_END once no whole block remains
+ */
+
+salesExportError readSalesExportEvent(salesExportReader &reader, salesExportEvent &event) {
+    if (reader.nextEvent == reader.block.eventCount) {
+        salesExportError errorResult = readSalesExportBlock(reader);
+        if (errorResult != SALES_EXPORT_SUCCESS) {
+            return errorResult;
+        }
+    }
+
+    const salesExportBlock &block = reader.block;
+    const std::uint32_t i = reader.nextEvent++;
+    event.timeMilliseconds = block.timesMilliseconds[i];
+    event.orderNumber      = block.orderNumbers[i];
+    std::memcpy(event.itemCode, block.itemCodes[block.itemIds[i]], sizeof(event.itemCode));
+    event.quantity         = block.quantities[i];
+    event.revenueCents     = block.revenuesCents[i];
+
+    return SALES_EXPORT_SUCCESS;
+}
+
+/**
+ * @brief closeSalesExportReader closes the export file.
+ * @param reader = Reader to close passed by reference
+ */
+
+void closeSalesExportReader(salesExportReader &reader) {
+    if (reader.file != nullptr) {
+        std::fclose(reader.file);
+        reader.file = nullptr;
+    }
+}
+
+/**
+ * @brief getSalesExportErrorMessage returns a printable description of a sales export error.
+ * @param errorResult = salesExportError enum to describe
+ * @return = Null-terminated byte string constant describing the error
+ */
+
+const char *getSalesExportErrorMessage(salesExportError errorResult) {
+    if (errorResult == SALES_EXPORT_SUCCESS) {
+        return "Sales export ready.";
+    } else if (errorResult == SALES_EXPORT_UNOPENABLE) {
+        return "Sales export file could not be opened.";
+    } else if (errorResult == SALES_EXPORT_NOT_EXPORT_FILE) {
+        return "Sales export file is not a sales export.";
+    } else if (errorResult == SALES_EXPORT_WRITE_FAILED) {
+        return "Sales export file could not be written.";
+    } else {
+        return "End of sales export.";
+    }
+}
+
+/**
+ * @brief writeSalesExportBlock writes the block being filled and starts an empty one. The file is flushed so it always
+ *        ends in whole blocks ready to upload. On failure, exporting stops.
+ * @param exporter = Exporter passed by reference
+ * @return = salesExportError enum representing the result of writing the block
+ */
+
+static salesExportError writeSalesExportBlock(salesExporter &exporter) {
+    unsigned char blockBytes[SALES_EXPORT_BLOCK_HEADER_SIZE + MAX_SALES_EXPORT_BLOCK_SIZE + SALES_EXPORT_BLOCK_TRAILER_SIZE];
+    unsigned char *payload = blockBytes + SALES_EXPORT_BLOCK_HEADER_SIZE;
+    const std::size_t payloadSize = encodeSalesExportBlock(payload, exporter.block);
+    writeLittleEndian32(blockBytes, SALES_EXPORT_BLOCK_MAGIC);
+    writeLittleEndian32(blockBytes + 4, static_cast<std::uint32_t>(payloadSize));
+    writeLittleEndian32(payload + payloadSize, hashSalesExportPayload(payload, payloadSize));
+
+    clearSalesExportBlock(exporter);
+
+    const std::size_t blockSize = SALES_EXPORT_BLOCK_HEADER_SIZE + payloadSize + SALES_EXPORT_BLOCK_TRAILER_SIZE;
+    if (std::fwrite(blockBytes, 1, blockSize, exporter.file) != blockSize || std::fflush(exporter.file) != 0) {
+        std::fclose(exporter.file);
+        exporter.file = nullptr;
+        return SALES_EXPORT_WRITE_FAILED;
+    }
+
+    return SALES_EXPORT_SUCCESS;
+}
+
+/**
+ * @brief clearSalesExportBlock empties the block being filled and its item code dictionary.
+ * @param exporter = Exporter passed by reference
+ */
+
+static void clearSalesExportBlock(salesExporter &exporter) {
+    exporter.block.eventCount = 0;
+    exporter.block.itemCodeCount = 0;
+    std::memset(exporter.itemCodeSlots, 0, sizeof(exporter.itemCodeSlots));
+}
+
+/**
+ * @brief encodeSalesExportBlock writes a block payload column by column: event count, item code dictionary, then
+ *        times and order numbers as zigzag varint deltas from the previous event, then item ids, quantities, and
+ *        revenues as varints. Similar values sit together, so a typical event takes a handful of bytes.
+ * @param payload = Buffer of MAX_SALES_EXPORT_BLOCK_SIZE bytes to receive the payload
+ * @param block = Block to encode
+ * @return = Size of payload in bytes
+ */
+
+static std::size_t encodeSalesExportBlock(unsigned char *payload, const salesExportBlock &block) {
+    unsigned char *output = payload;
+
+    output = writeVarint(output, block.eventCount);
+    output = writeVarint(output, block.itemCodeCount);
+    for (std::uint32_t i = 0; i < block.itemCodeCount; ++i) {
+        const std::size_t codeLength = std::strlen(block.itemCodes[i]);
+        *output++ = static_cast<unsigned char>(codeLength);
+        std::memcpy(output, block.itemCodes[i], codeLength);
+        output += codeLength;
+    }
+
+    // The first delta of each block is from zero, so every block decodes on its own.
+    std::int64_t previousTime = 0;
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        output = writeVarint(output, encodeZigzag(block.timesMilliseconds[i] - previousTime));
+        previousTime = block.timesMilliseconds[i];
+    }
+    std::uint64_t previousOrderNumber = 0;
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        output = writeVarint(output, encodeZigzag(static_cast<std::int64_t>(block.orderNumbers[i] - previousOrderNumber)));
+        previousOrderNumber = block.orderNumbers[i];
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        output = writeVarint(output, block.itemIds[i]);
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        output = writeVarint(output, static_cast<std::uint64_t>(block.quantities[i]));
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        output = writeVarint(output, static_cast<std::uint64_t>(block.revenuesCents[i]));
+    }
+
+    return static_cast<std::size_t>(output - payload);
+}
+
+/**
+ * @brief decodeSalesExportBlock reads a block payload written by encodeSalesExportBlock(), checking every length and
+ *        id against the payload.
+ * @param block = Block to receive events passed by reference
+ * @param payload = Payload bytes
+ * @param payloadSize = Size of payload in bytes
+ * @return = Boolean indicating whether the payload was a valid block
+ */
+
+static bool decodeSalesExportBlock(salesExportBlock &block, const unsigned char *payload, std::size_t payloadSize) {
+    const unsigned char *input = payload;
+    const unsigned char *inputEnd = payload + payloadSize;
+    std::uint64_t value = 0;
+
+    // Event count and item code dictionary
+    if (!readVarint(input, inputEnd, value) || value == 0 || value > SALES_EXPORT_BLOCK_EVENTS) {
+        return false;
+    }
+    block.eventCount = static_cast<std::uint32_t>(value);
+    if (!readVarint(input, inputEnd, value) || value == 0 || value > block.eventCount) {
+        return false;
+    }
+    block.itemCodeCount = static_cast<std::uint32_t>(value);
+    for (std::uint32_t i = 0; i < block.itemCodeCount; ++i) {
+        if (input == inputEnd || *input > MAX_CATALOG_CODE_LENGTH || inputEnd - (input + 1) < *input) {
+            return false;
+        }
+        const std::size_t codeLength = *input++;
+        std::memcpy(block.itemCodes[i], input, codeLength);
+        block.itemCodes[i][codeLength] = '\0';
+        input += codeLength;
+    }
+
+    // Columns
+    std::int64_t previousTime = 0;
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        if (!readVarint(input, inputEnd, value)) {
+            return false;
+        }
+        previousTime += decodeZigzag(value);
+        block.timesMilliseconds[i] = previousTime;
+    }
+    std::uint64_t previousOrderNumber = 0;
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        if (!readVarint(input, inputEnd, value)) {
+            return false;
+        }
+        previousOrderNumber += static_cast<std::uint64_t>(decodeZigzag(value));
+        block.orderNumbers[i] = previousOrderNumber;
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        if (!readVarint(input, inputEnd, value) || value >= block.itemCodeCount) {
+            return false;
+        }
+        block.itemIds[i] = static_cast<std::uint32_t>(value);
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        if (!readVarint(input, inputEnd, value)) {
+            return false;
+        }
+        block.quantities[i] = static_cast<std::int64_t>(value);
+    }
+    for (std::uint32_t i = 0; i < block.eventCount; ++i) {
+        if (!readVarint(input, inputEnd, value)) {
+            return false;
+        }
+        block.revenuesCents[i] = static_cast<std::int64_t>(value);
+    }
+
+    return input == inputEnd;
+}
+
+/**
+ * @brief readSalesExportBlock reads the next whole block. Bytes that do not start a block with a matching checksum,
+ *        such as the middle of a block after a resume offset or a block cut off by a crash, are skipped one at a time.
+ * @param reader = Reader passed by reference
+ * @return = salesExportError enum, SALES_EXPORT_END once no whole block remains
+ */
+
+static salesExportError readSalesExportBlock(salesExportReader &reader) {
+    reader.block.eventCount = 0;
+    reader.nextEvent = 0;
+
+    long blockStart = reader.blockEndOffset;
+    for (;; ++blockStart) {
+        unsigned char blockHeader[SALES_EXPORT_BLOCK_HEADER_SIZE];
+        unsigned char blockTrailer[SALES_EXPORT_BLOCK_TRAILER_SIZE];
+        if (std::fseek(reader.file, blockStart, SEEK_SET) != 0 || std::fread(blockHeader, 1, sizeof(blockHeader), reader.file) != sizeof(blockHeader)) {
+            return SALES_EXPORT_END;
+        }
+        if (readLittleEndian32(blockHeader) != SALES_EXPORT_BLOCK_MAGIC) {
+            continue;
+        }
+
+        const std::uint32_t payloadSize = readLittleEndian32(blockHeader + 4);
+        if (payloadSize == 0 || payloadSize > MAX_SALES_EXPORT_BLOCK_SIZE ||
+            std::fread(reader.payload, 1, payloadSize, reader.file) != payloadSize ||
+            std::fread(blockTrailer, 1, sizeof(blockTrailer), reader.file) != sizeof(blockTrailer) ||
+            readLittleEndian32(blockTrailer) != hashSalesExportPayload(reader.payload, payloadSize) ||
+            !decodeSalesExportBlock(reader.block, reader.payload, payloadSize)) {
+            reader.block.eventCount = 0;
+            continue;
+        }
+
+        reader.blockEndOffset = blockStart + static_cast<long>(SALES_EXPORT_BLOCK_HEADER_SIZE + payloadSize + SALES_EXPORT_BLOCK_TRAILER_SIZE);
+
+        return SALES_EXPORT_SUCCESS;
+    }
+}
+
+/**
+ * @brief writeVarint writes an unsigned integer 7 bits per byte, low bits first, with the high bit set on every byte
+ *        but the last.
+ * @param output = Pointer to write at
+ * @param value = Value to write
+ * @return = Pointer past the last byte written
+ */
+
+static unsigned char *writeVarint(unsigned char *output, std::uint64_t value) {
+    while (value >= 0x80) {
+        *output++ = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    *output++ = static_cast<unsigned char>(value);
+
+    return output;
+}
+
+/**
+ * @brief readVarint reads an unsigned integer written by writeVarint().
+ * @param input = Pointer to read at passed by reference (advanced past the value)
+ * @param inputEnd = Pointer past the last byte that may be read
+ * @param value = Integer to receive the value passed by reference
+ * @return = Boolean indicating whether a whole value of at most 64 bits was read
+ */
+
+static bool readVarint(const unsigned char *&input, const unsigned char *inputEnd, std::uint64_t &value) {
+    value = 0;
+    for (unsigned int shift = 0; shift < 64 && input < inputEnd; shift += 7) {
+        const unsigned char byte = *input++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief encodeZigzag maps signed integers to unsigned ones so small negative values stay small (0, -1, 1, -2 become
+ *        0, 1, 2, 3).
+ * @param value = Signed value
+ * @return = Unsigned value
+ */
+
+static std::uint64_t encodeZigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+/**
+ * @brief decodeZigzag reverses encodeZigzag().
+ * @param value = Unsigned value
+ * @return = Signed value
+ */
+
+static std::int64_t decodeZigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+/**
+ * @brief writeLittleEndian32 writes a 32-bit integer low byte first.
+ * @param output = Pointer to 4 bytes to write
+ * @param value = Value to write
+ */
+
+static void writeLittleEndian32(unsigned char *output, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        output[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief readLittleEndian32 reads a 32-bit integer written by writeLittleEndian32().
+ * @param input = Pointer to 4 bytes to read
+ * @return = Value read
+ */
+
+static std::uint32_t readLittleEndian32(const unsigned char *input) {
+    return static_cast<std::uint32_t>(input[0]) | static_cast<std::uint32_t>(input[1]) << 8 | static_cast<std::uint32_t>(input[2]) << 16 | static_cast<std::uint32_t>(input[3]) << 24;
+}
+
+/**
+ * @brief hashSalesExportPayload checksums a block payload, or hashes an item code, with 32-bit FNV-1a.
+ * @param payload = Payload bytes
+ * @param payloadSize = Size of payload in bytes
+ * @return = 32-bit checksum
+ */
+
+static std::uint32_t hashSalesExportPayload(const unsigned char *payload, std::size_t payloadSize) {
+    std::uint32_t hash = 2166136261U;
+    for (std::size_t i = 0; i < payloadSize; ++i) {
+        hash ^= payload[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
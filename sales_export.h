@@ -0,0 +1,95 @@
+//================================================================================
+// Name        : sales_export.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Streaming export of order events to a compact column-wise
+//               binary file for upload, and the matching streaming reader
+//================================================================================
+
+#ifndef SALES_EXPORT_H
+#define SALES_EXPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "catalog.h"
+
+// Identifies an export file and its format, and marks the start of each block so a reader can find the next block
+// from any byte offset. Written little-endian.
+const std::uint32_t SALES_EXPORT_FILE_MAGIC    = 0x52465453; // "RFTS"
+const std::uint32_t SALES_EXPORT_FILE_VERSION  = 1;
+const std::uint32_t SALES_EXPORT_BLOCK_MAGIC   = 0x52465442; // "RFTB"
+const long SALES_EXPORT_FILE_HEADER_SIZE       = 8;
+
+// Most events held before a block is written, and the largest block payload. A full block with every code and value
+// at its widest takes under 15,000 bytes.
+const unsigned int SALES_EXPORT_BLOCK_EVENTS = 256;
+const std::size_t MAX_SALES_EXPORT_BLOCK_SIZE = 16384;
+
+// A completed order ends the block being filled once the block holds this many events or its first event is this old,
+// bounding what a killed run loses while keeping blocks long enough for the dictionary and deltas to pay off.
+const unsigned int SALES_EXPORT_FLUSH_EVENTS = 64;
+const std::int64_t SALES_EXPORT_FLUSH_MILLISECONDS = 15 * 60 * 1000;
+
+enum salesExportError { SALES_EXPORT_SUCCESS, SALES_EXPORT_UNOPENABLE, SALES_EXPORT_NOT_EXPORT_FILE, SALES_EXPORT_WRITE_FAILED, SALES_EXPORT_END };
+
+// One item line of an order. Items are identified by their stable catalog code.
+struct salesExportEvent {
+    std::int64_t timeMilliseconds;
+    std::uint64_t orderNumber;
+    char itemCode[MAX_CATALOG_CODE_LENGTH + 1];
+    std::int64_t quantity;
+    std::int64_t revenueCents;
+};
+
+// Events of one block, column by column. Item codes are numbered in order of first use within the block, so every
+// block decodes on its own.
+struct salesExportBlock {
+    std::int64_t timesMilliseconds[SALES_EXPORT_BLOCK_EVENTS];
+    std::uint64_t orderNumbers[SALES_EXPORT_BLOCK_EVENTS];
+    std::uint32_t itemIds[SALES_EXPORT_BLOCK_EVENTS];
+    std::int64_t quantities[SALES_EXPORT_BLOCK_EVENTS];
+    std::int64_t revenuesCents[SALES_EXPORT_BLOCK_EVENTS];
+    char itemCodes[SALES_EXPORT_BLOCK_EVENTS][MAX_CATALOG_CODE_LENGTH + 1];
+    std::uint32_t itemCodeCount;
+    std::uint32_t eventCount;
+};
+
+// Appends events to an export file one block at a time, so memory use never grows with the day's sales. The order
+// number advances with the first event after startSalesExportOrder(). Item codes of the block being filled are found
+// through an open-addressing hash table whose slots hold item id + 1, or 0 when empty.
+struct salesExporter {
+    std::FILE *file;
+    salesExportBlock block;
+    std::uint16_t itemCodeSlots[2 * SALES_EXPORT_BLOCK_EVENTS];
+    std::uint64_t orderNumber;
+    bool isOrderStarted;
+};
+
+// Reads events from an export file one block at a time, starting at any byte offset. blockEndOffset is where reading
+// can resume after the last block read.
+struct salesExportReader {
+    std::FILE *file;
+    salesExportBlock block;
+    std::uint32_t nextEvent;
+    long blockEndOffset;
+    unsigned char payload[MAX_SALES_EXPORT_BLOCK_SIZE];
+};
+
+salesExportError openSalesExport(salesExporter &exporter, const char *exportPath);
+void startSalesExportOrder(salesExporter &exporter);
+salesExportError finishSalesExportOrder(salesExporter &exporter, std::int64_t timeMilliseconds);
+salesExportError recordSalesExportEvent(salesExporter &exporter, std::int64_t timeMilliseconds, const std::string &itemCode, std::int64_t quantity, std::int64_t revenueCents);
+salesExportError closeSalesExport(salesExporter &exporter);
+std::int64_t getSalesExportTime();
+
+salesExportError openSalesExportReader(salesExportReader &reader, const char *exportPath, long startOffset);
+salesExportError readSalesExportEvent(salesExportReader &reader, salesExportEvent &event);
+void closeSalesExportReader(salesExportReader &reader);
+
+const char *getSalesExportErrorMessage(salesExportError errorResult);
+
+#endif // SALES_EXPORT_H
@@ -0,0 +1,282 @@
+//================================================================================
+// Name        : sales_export_reader.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Decodes a sales export from the Rebel Food Truck Inventory
+//               Sales Program to CSV and benchmarks the format against CSV
+//================================================================================
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sales_export.h"
+
+// Files written by the benchmark in the current directory and removed afterwards
+#define BENCHMARK_EXPORT_PATH "sales_export_benchmark.rfts"
+#define BENCHMARK_CSV_PATH    "sales_export_benchmark.csv"
+
+// Totals of decoded events, used to check both formats read back the same sales
+struct salesEventTotals {
+    std::uint64_t eventCount;
+    std::int64_t quantity;
+    std::int64_t revenueCents;
+    std::uint64_t orderNumberSum;
+};
+
+int decodeSalesExport(const char *exportPath, long startOffset);
+int benchmarkSalesExport(long long eventCount, int itemCount);
+std::uint64_t getNextBenchmarkRandom(std::uint64_t &randomState);
+bool readCsvSales(const char *csvPath, salesEventTotals &totals);
+double getSecondsSince(const std::chrono::steady_clock::time_point &startTime);
+
+int main(int argc, char *argv[]) {
+    // Determine mode selected.
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        long long eventCount = argc > 2 ? std::atoll(argv[2]) : 1000000;
+        int itemCount = argc > 3 ? std::atoi(argv[3]) : 20;
+        if (eventCount < 1 || itemCount < 1 || itemCount > 9999) {
+            std::cerr << "Usage: " << argv[0] << " --benchmark [events] [items]" << std::endl;
+            return 1;
+        }
+        return benchmarkSalesExport(eventCount, itemCount);
+    } else if (argc < 2 || argc > 3 || argv[1][0] == '-') {
+        std::cerr << "Usage: " << argv[0] << " export_file [start_offset] | --benchmark [events] [items]" << std::endl;
+        return 1;
+    }
+
+    return decodeSalesExport(argv[1], argc > 2 ? std::atol(argv[2]) : 0);
+}
+
+/**
+ * @brief decodeSalesExport prints every event from a byte offset on as CSV, then reports the offset to resume at.
+ * @param exportPath = Path of export file
+ * @param startOffset = Byte offset to start at
+ * @return = Integer exit status
+ */
+
+int decodeSalesExport(const char *exportPath, long startOffset) {
+    salesExportReader *reader = new salesExportReader;
+    salesExportError errorResult = openSalesExportReader(*reader, exportPath, startOffset);
+    if (errorResult != SALES_EXPORT_SUCCESS) {
+        std::cerr << getSalesExportErrorMessage(errorResult) << std::endl;
+        delete reader;
+        return 1;
+    }
+
+    std::printf("time_ms,order,item,quantity,revenue_cents\n");
+    salesExportEvent event;
+    while (readSalesExportEvent(*reader, event) == SALES_EXPORT_SUCCESS) {
+        std::printf("%" PRId64 ",%" PRIu64 ",%s,%" PRId64 ",%" PRId64 "\n", event.timeMilliseconds, event.orderNumber, event.itemCode, event.quantity, event.revenueCents);
+    }
+    std::fflush(stdout);
+    std::cerr << "Resume offset: " << reader->blockEndOffset << std::endl;
+
+    closeSalesExportReader(*reader);
+    delete reader;
+
+    return 0;
+}
+
+/**
+ * @brief benchmarkSalesExport writes the same synthetic day of orders as a sales export and as CSV, reads both back,
+ *        and compares their size and speed.
+ * @param eventCount = Number of item lines to write
+ * @param itemCount = Number of distinct items sold
+ * @return = Integer exit status (1 if either format read back different totals)
+ */
+
+int benchmarkSalesExport(long long eventCount, int itemCount) {
+    // Item codes and prices
+    std::vector<std::string> itemCodes;
+    std::vector<std::int64_t> itemPricesCents;
+    for (int i = 0; i < itemCount; ++i) {
+        itemCodes.push_back("ITEM" + std::to_string(i));
+        itemPricesCents.push_back(300 + 25 * (i % 24));
+    }
+
+    salesExporter *exporter = new salesExporter;
+    std::remove(BENCHMARK_EXPORT_PATH);
+    salesExportError errorResult = openSalesExport(*exporter, BENCHMARK_EXPORT_PATH);
+    std::FILE *csvFile = std::fopen(BENCHMARK_CSV_PATH, "wb");
+    if (errorResult != SALES_EXPORT_SUCCESS || csvFile == nullptr) {
+        std::cerr << "Could not create benchmark files." << std::endl;
+        closeSalesExport(*exporter);
+        delete exporter;
+        if (csvFile != nullptr) {
+            std::fclose(csvFile);
+        }
+        return 1;
+    }
+
+    // Orders of 1 to 4 item lines, a few seconds to minutes apart, with mostly small quantities and popular items.
+    // Each format is written in its own pass over the same random sequence. Export blocks end as in the program.
+    salesEventTotals writtenTotals = { 0, 0, 0, 0 };
+    double writeSeconds[2] = { 0.0, 0.0 };
+    for (int pass = 0; pass < 2; ++pass) {
+        std::uint64_t randomState = 20210912;
+        std::int64_t timeMilliseconds = 1631458800000LL;
+        std::uint64_t orderNumber = 0;
+        long long eventsWritten = 0;
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+        while (eventsWritten < eventCount) {
+            ++orderNumber;
+            timeMilliseconds += 5000 + static_cast<std::int64_t>(getNextBenchmarkRandom(randomState) % 180000);
+            startSalesExportOrder(*exporter);
+
+            const long long orderLineCount = 1 + static_cast<long long>(getNextBenchmarkRandom(randomState) % 4);
+            for (long long i = 0; i < orderLineCount && eventsWritten < eventCount; ++i, ++eventsWritten) {
+                const std::uint64_t itemRandom = getNextBenchmarkRandom(randomState);
+                const int itemIndex = static_cast<int>((itemRandom % itemCount) * (itemRandom / itemCount % itemCount) / itemCount);
+                const std::int64_t quantity = 1 + static_cast<std::int64_t>(getNextBenchmarkRandom(randomState) % 16 / 6);
+                const std::int64_t revenueCents = quantity * itemPricesCents[itemIndex];
+                timeMilliseconds += static_cast<std::int64_t>(getNextBenchmarkRandom(randomState) % 40);
+
+                if (pass == 0) {
+                    recordSalesExportEvent(*exporter, timeMilliseconds, itemCodes[itemIndex], quantity, revenueCents);
+                    writtenTotals.eventCount += 1;
+                    writtenTotals.quantity += quantity;
+                    writtenTotals.revenueCents += revenueCents;
+                    writtenTotals.orderNumberSum += orderNumber;
+                } else {
+                    std::fprintf(csvFile, "%" PRId64 ",%" PRIu64 ",%s,%" PRId64 ",%" PRId64 "\n", timeMilliseconds, orderNumber, itemCodes[itemIndex].c_str(), quantity, revenueCents);
+                }
+            }
+            if (pass == 0 && errorResult == SALES_EXPORT_SUCCESS) {
+                errorResult = finishSalesExportOrder(*exporter, timeMilliseconds);
+            }
+        }
+        if (pass == 0) {
+            errorResult = closeSalesExport(*exporter);
+        } else if (std::fclose(csvFile) != 0) {
+            errorResult = SALES_EXPORT_WRITE_FAILED;
+        }
+        writeSeconds[pass] = getSecondsSince(startTime);
+    }
+    delete exporter;
+
+    // Read the export back.
+    salesEventTotals exportTotals = { 0, 0, 0, 0 };
+    salesExportReader *reader = new salesExportReader;
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    if (errorResult == SALES_EXPORT_SUCCESS && openSalesExportReader(*reader, BENCHMARK_EXPORT_PATH, 0) == SALES_EXPORT_SUCCESS) {
+        salesExportEvent event;
+        while (readSalesExportEvent(*reader, event) == SALES_EXPORT_SUCCESS) {
+            exportTotals.eventCount += 1;
+            exportTotals.quantity += event.quantity;
+            exportTotals.revenueCents += event.revenueCents;
+            exportTotals.orderNumberSum += event.orderNumber;
+        }
+        closeSalesExportReader(*reader);
+    }
+    const double exportReadSeconds = getSecondsSince(startTime);
+    delete reader;
+
+    // Read the CSV back.
+    salesEventTotals csvTotals = { 0, 0, 0, 0 };
+    startTime = std::chrono::steady_clock::now();
+    readCsvSales(BENCHMARK_CSV_PATH, csvTotals);
+    const double csvReadSeconds = getSecondsSince(startTime);
+
+    // Determine file sizes.
+    long fileSizes[2] = { 0, 0 };
+    const char *filePaths[2] = { BENCHMARK_EXPORT_PATH, BENCHMARK_CSV_PATH };
+    for (int i = 0; i < 2; ++i) {
+        std::FILE *file = std::fopen(filePaths[i], "rb");
+        if (file != nullptr) {
+            std::fseek(file, 0, SEEK_END);
+            fileSizes[i] = std::ftell(file);
+            std::fclose(file);
+        }
+        std::remove(filePaths[i]);
+    }
+
+    const bool isExportMatching = exportTotals.eventCount == writtenTotals.eventCount && exportTotals.quantity == writtenTotals.quantity && exportTotals.revenueCents == writtenTotals.revenueCents && exportTotals.orderNumberSum == writtenTotals.orderNumberSum;
+    const bool isCsvMatching = csvTotals.eventCount == writtenTotals.eventCount && csvTotals.quantity == writtenTotals.quantity && csvTotals.revenueCents == writtenTotals.revenueCents && csvTotals.orderNumberSum == writtenTotals.orderNumberSum;
+
+    std::stringstream resultOSS;
+    resultOSS << std::fixed << std::setprecision(2)
+              << "Events: " << eventCount << " (" << itemCount << " items)" << std::endl << std::endl
+              << std::left << std::setw(8) << "Format" << std::right << std::setw(14) << "Bytes" << std::setw(14) << "Bytes/Event" << std::setw(22) << "Write (M events/s)" << std::setw(22) << "Read (M events/s)" << std::endl
+              << std::left << std::setw(8) << "Export" << std::right << std::setw(14) << fileSizes[0] << std::setw(14) << static_cast<double>(fileSizes[0]) / eventCount << std::setw(22) << eventCount / writeSeconds[0] / 1e6 << std::setw(22) << eventCount / exportReadSeconds / 1e6 << std::endl
+              << std::left << std::setw(8) << "CSV" << std::right << std::setw(14) << fileSizes[1] << std::setw(14) << static_cast<double>(fileSizes[1]) / eventCount << std::setw(22) << eventCount / writeSeconds[1] / 1e6 << std::setw(22) << eventCount / csvReadSeconds / 1e6 << std::endl << std::endl
+              << "Export size: " << (fileSizes[1] > 0 ? 100.0 * fileSizes[0] / fileSizes[1] : 0.0) << "% of CSV" << std::endl
+              << "Read back: " << (isExportMatching ? "export matches" : "export DIFFERS") << ", " << (isCsvMatching ? "CSV matches" : "CSV DIFFERS") << std::endl;
+    std::cout << resultOSS.str();
+
+    return isExportMatching && isCsvMatching ? 0 : 1;
+}
+
+/**
+ * @brief getNextBenchmarkRandom advances a xorshift generator, so every run writes the same orders.
+ * @param randomState = Generator state passed by reference
+ * @return = Next pseudo-random value
+ */
+
+std::uint64_t getNextBenchmarkRandom(std::uint64_t &randomState) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+
+    return randomState;
+}
+
+/**
+ * @brief readCsvSales parses every line of a CSV written by the benchmark, as an upload consumer would.
+ * @param csvPath = Path of CSV file
+ * @param totals = Totals to receive the sum of each column passed by reference
+ * @return = Boolean indicating whether the file could be read
+ */
+
+bool readCsvSales(const char *csvPath, salesEventTotals &totals) {
+    std::FILE *csvFile = std::fopen(csvPath, "rb");
+    if (csvFile == nullptr) {
+        return false;
+    }
+
+    char line[128];
+    salesExportEvent event;
+    while (std::fgets(line, sizeof(line), csvFile) != nullptr) {
+        char *field = line;
+        event.timeMilliseconds = std::strtoll(field, &field, 10);
+        event.orderNumber = std::strtoull(field + 1, &field, 10);
+
+        // Copy item code up to the next comma.
+        char *codeStart = field + 1;
+        char *codeEnd = std::strchr(codeStart, ',');
+        if (codeEnd == nullptr || codeEnd - codeStart > MAX_CATALOG_CODE_LENGTH) {
+            continue;
+        }
+        std::memcpy(event.itemCode, codeStart, codeEnd - codeStart);
+        event.itemCode[codeEnd - codeStart] = '\0';
+
+        event.quantity = std::strtoll(codeEnd + 1, &field, 10);
+        event.revenueCents = std::strtoll(field + 1, &field, 10);
+
+        totals.eventCount += 1;
+        totals.quantity += event.quantity;
+        totals.revenueCents += event.revenueCents;
+        totals.orderNumberSum += event.orderNumber;
+    }
+    std::fclose(csvFile);
+
+    return true;
+}
+
+/**
+ * @brief getSecondsSince returns the time elapsed since a start time.
+ * @param startTime = Start time
+ * @return = Seconds elapsed
+ */
+
+double getSecondsSince(const std::chrono::steady_clock::time_point &startTime) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+}
@@ -0,0 +1,19 @@
+QT -= gui core
+
+CONFIG += c++11 console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ..
+
+SOURCES += \
+    sales_export_reader.cpp \
+    ../sales_export.cpp
+
+HEADERS += \
+    ../catalog.h \
+    ../sales_export.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,692 @@
+//================================================================================
+// Name        : session_replay.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Records operator sessions with the Rebel Food Truck Inventory
+//               Sales Program and replays them against a build, checking
+//               output and per-screen latency against a budget
+//================================================================================
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef __unix__
+#include <climits>
+#include <csignal>
+#include <dirent.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "terminal_renderer.h"
+
+// First line of every session file. Sessions recorded before screens were timed are still read.
+#define SESSION_FILE_HEADER "REBEL FOOD TRUCK SESSION 2"
+#define UNTIMED_SESSION_FILE_HEADER "REBEL FOOD TRUCK SESSION 1"
+
+// Configuration file the program reads from its working directory, and the line added to every fixture so sales are
+// exported into the run's own directory instead of the truck's export file.
+#define FIXTURE_CONFIGURATION_NAME "rebel_food_truck.cfg"
+#define FIXTURE_EXPORT_LINE "sales_export_path = sales_export.bin"
+
+// Longest wait for a screen before the program is considered stuck, and for the program to exit after its input ends.
+const int SCREEN_TIMEOUT_MILLISECONDS = 10000;
+const int EXIT_TIMEOUT_MILLISECONDS   = 1000;
+
+enum replayResult { REPLAY_SUCCESS, REPLAY_OUTPUT_MISMATCH, REPLAY_OVER_BUDGET, REPLAY_ERROR };
+
+// One screen of a session: the line entered (none for the first screen), the output up to the next prompt, and how
+// long the screen took when recorded (negative if not recorded).
+struct sessionStep {
+    bool hasInput;
+    std::string input;
+    std::string output;
+    double recordedMilliseconds;
+};
+
+// Running program with its stdin and stdout connected to pipes. Each run has its own working directory and inventory
+// publication, so a session never reads or changes the truck's configuration, export file, or live inventory.
+struct programProcess {
+    int processId;
+    int inputDescriptor;
+    int outputDescriptor;
+    std::string workingDirectory;
+    std::string publicationName;
+};
+
+bool startProgram(programProcess &process, char **programArguments, const char *fixturePath);
+bool writeInputLine(programProcess &process, const std::string &inputLine);
+bool readScreen(programProcess &process, std::string &screenOutput);
+void stopProgram(programProcess &process);
+bool writeFixtureConfiguration(const std::string &workingDirectory, const char *fixturePath);
+void removeWorkingDirectory(const std::string &workingDirectory);
+std::string maskExpiryTimes(const std::string &screenOutput);
+bool saveSession(const std::vector<sessionStep> &steps, const char *sessionPath);
+bool loadSession(std::vector<sessionStep> &steps, const char *sessionPath);
+int recordSession(const char *sessionPath, char **programArguments, const char *fixturePath);
+int replaySession(const char *sessionPath, char **programArguments, const char *fixturePath, int runCount, double screenBudgetMilliseconds, double totalBudgetMilliseconds, double maxSlowdown, double slowdownMarginMilliseconds);
+void printOutputDifference(const std::string &expectedOutput, const std::string &actualOutput);
+
+int main(int argc, char *argv[]) {
+    // Options before "--", program and its arguments after
+    int separatorIndex = 1;
+    while (separatorIndex < argc && std::strcmp(argv[separatorIndex], "--") != 0) {
+        ++separatorIndex;
+    }
+
+    const std::string usage = std::string(argv[0]) + " --record session_file [--config file] -- program [arguments]\n       " + argv[0] + " --replay session_file [--config file] [--runs n] [--screen-budget-ms ms] [--total-budget-ms ms] [--max-slowdown ratio] [--slowdown-margin-ms ms] -- program [arguments]";
+    if (separatorIndex + 1 >= argc || separatorIndex < 3) {
+        std::cerr << "Usage: " << usage << std::endl;
+        return REPLAY_ERROR;
+    }
+    char **programArguments = argv + separatorIndex + 1;
+
+    // Configuration the program runs with (built-in defaults if none is given)
+    const char *fixturePath = nullptr;
+
+    if (std::strcmp(argv[1], "--record") == 0) {
+        bool isUsageValid = (separatorIndex - 3) % 2 == 0;
+        for (int i = 3; i + 1 < separatorIndex; i += 2) {
+            if (std::strcmp(argv[i], "--config") == 0) {
+                fixturePath = argv[i + 1];
+            } else {
+                isUsageValid = false;
+            }
+        }
+        if (!isUsageValid) {
+            std::cerr << "Usage: " << usage << std::endl;
+            return REPLAY_ERROR;
+        }
+        return recordSession(argv[2], programArguments, fixturePath);
+    } else if (std::strcmp(argv[1], "--replay") == 0) {
+        int runCount = 1;
+        double screenBudgetMilliseconds = 100.0;
+        double totalBudgetMilliseconds = 0.0;
+        double maxSlowdown = 3.0;
+        double slowdownMarginMilliseconds = 10.0;
+        for (int i = 3; i + 1 < separatorIndex; i += 2) {
+            if (std::strcmp(argv[i], "--config") == 0) {
+                fixturePath = argv[i + 1];
+            } else if (std::strcmp(argv[i], "--runs") == 0) {
+                runCount = std::atoi(argv[i + 1]);
+            } else if (std::strcmp(argv[i], "--screen-budget-ms") == 0) {
+                screenBudgetMilliseconds = std::atof(argv[i + 1]);
+            } else if (std::strcmp(argv[i], "--total-budget-ms") == 0) {
+                totalBudgetMilliseconds = std::atof(argv[i + 1]);
+            } else if (std::strcmp(argv[i], "--max-slowdown") == 0) {
+                maxSlowdown = std::atof(argv[i + 1]);
+            } else if (std::strcmp(argv[i], "--slowdown-margin-ms") == 0) {
+                slowdownMarginMilliseconds = std::atof(argv[i + 1]);
+            } else {
+                runCount = 0;
+            }
+        }
+        if (runCount < 1 || (separatorIndex - 3) % 2 != 0) {
+            std::cerr << "Usage: " << usage << std::endl;
+            return REPLAY_ERROR;
+        }
+        return replaySession(argv[2], programArguments, fixturePath, runCount, screenBudgetMilliseconds, totalBudgetMilliseconds, maxSlowdown, slowdownMarginMilliseconds);
+    }
+
+    std::cerr << "Usage: " << usage << std::endl;
+    return REPLAY_ERROR;
+}
+
+/**
+ * @brief recordSession runs the program, passes each line the operator enters to it, shows its output, and saves every
+ *        line, the screen that followed it, and how long the screen took from the line being sent to the next prompt.
+ *        Input may also be piped in, for example from a saved list of inputs.
+ * @param sessionPath = Path of session file to write
+ * @param programArguments = Null-terminated program path and arguments
+ * @param fixturePath = Configuration file to run the program with, or null for built-in defaults
+ * @return = replayResult enum representing the result of recording
+ */
+
+int recordSession(const char *sessionPath, char **programArguments, const char *fixturePath) {
+    programProcess process;
+    if (!startProgram(process, programArguments, fixturePath)) {
+        std::cerr << "Unable to start " << programArguments[0] << "." << std::endl;
+        return REPLAY_ERROR;
+    }
+
+    // First screen before any input
+    std::vector<sessionStep> steps(1);
+    steps[0].hasInput = false;
+    std::chrono::steady_clock::time_point screenStart = std::chrono::steady_clock::now();
+    bool isRunning = readScreen(process, steps[0].output);
+    steps[0].recordedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - screenStart).count();
+    std::cout << steps[0].output << std::flush;
+
+    // Pass each line through until the program exits or the operator's input ends.
+    std::string operatorInput;
+    while (isRunning && std::getline(std::cin, operatorInput)) {
+        sessionStep step;
+        step.hasInput = true;
+        step.input = operatorInput;
+
+        screenStart = std::chrono::steady_clock::now();
+        if (!writeInputLine(process, operatorInput)) {
+            break;
+        }
+        isRunning = readScreen(process, step.output);
+        step.recordedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - screenStart).count();
+        std::cout << step.output << std::flush;
+        steps.push_back(step);
+    }
+
+    if (isRunning) {
+        std::cerr << "Input ended before the program quit. The session ends at the last complete screen." << std::endl;
+    }
+    stopProgram(process);
+
+    if (!saveSession(steps, sessionPath)) {
+        std::cerr << "Unable to write " << sessionPath << "." << std::endl;
+        return REPLAY_ERROR;
+    }
+    std::cerr << "Recorded " << steps.size() - 1 << " inputs to " << sessionPath << "." << std::endl;
+
+    return REPLAY_SUCCESS;
+}
+
+/**
+ * @brief replaySession feeds a recorded session to the program, checks each screen against the recording, and measures
+ *        how long each screen takes from the line being sent to the next prompt. With several runs, each screen's
+ *        fastest time is kept to filter out scheduling noise. A screen slower than its recorded time times maxSlowdown
+ *        plus slowdownMarginMilliseconds fails the replay, so a slowdown on any one screen is caught even when it stays
+ *        within the absolute budget. Expiry countdowns are masked, since they depend on when the session runs.
+ * @param sessionPath = Path of session file to replay
+ * @param programArguments = Null-terminated program path and arguments
+ * @param fixturePath = Configuration file to run the program with, or null for built-in defaults
+ * @param runCount = Number of times to replay the session
+ * @param screenBudgetMilliseconds = Slowest screen allowed (0 for no limit)
+ * @param totalBudgetMilliseconds = Longest session allowed (0 for no limit)
+ * @param maxSlowdown = Largest ratio of a screen's time to its recorded time allowed (0 for no limit)
+ * @param slowdownMarginMilliseconds = Time a screen may take beyond the allowed ratio, absorbing timer and scheduler noise
+ * @return = replayResult enum representing the result of replaying
+ */
+
+int replaySession(const char *sessionPath, char **programArguments, const char *fixturePath, int runCount, double screenBudgetMilliseconds, double totalBudgetMilliseconds, double maxSlowdown, double slowdownMarginMilliseconds) {
+    std::vector<sessionStep> steps;
+    if (!loadSession(steps, sessionPath)) {
+        std::cerr << "Unable to read session " << sessionPath << "." << std::endl;
+        return REPLAY_ERROR;
+    }
+
+    // Fastest time of each screen and of the whole session across runs
+    std::vector<double> screenMilliseconds(steps.size(), 0.0);
+    double totalMilliseconds = 0.0;
+
+    for (int run = 0; run < runCount; ++run) {
+        programProcess process;
+        std::chrono::steady_clock::time_point sessionStart = std::chrono::steady_clock::now();
+        if (!startProgram(process, programArguments, fixturePath)) {
+            std::cerr << "Unable to start " << programArguments[0] << "." << std::endl;
+            return REPLAY_ERROR;
+        }
+
+        for (std::vector<sessionStep>::size_type i = 0; i < steps.size(); ++i) {
+            std::chrono::steady_clock::time_point screenStart = std::chrono::steady_clock::now();
+            if (steps[i].hasInput && !writeInputLine(process, steps[i].input)) {
+                std::cerr << "Program exited before input " << i << " (\"" << steps[i].input << "\")." << std::endl;
+                stopProgram(process);
+                return REPLAY_OUTPUT_MISMATCH;
+            }
+
+            std::string screenOutput;
+            readScreen(process, screenOutput);
+            double elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - screenStart).count();
+            if (run == 0 || elapsedMilliseconds < screenMilliseconds[i]) {
+                screenMilliseconds[i] = elapsedMilliseconds;
+            }
+
+            const std::string expectedOutput = maskExpiryTimes(steps[i].output);
+            const std::string actualOutput = maskExpiryTimes(screenOutput);
+            if (actualOutput != expectedOutput) {
+                std::cerr << "Output differs from recording at screen " << i;
+                if (steps[i].hasInput) {
+                    std::cerr << " after input \"" << steps[i].input << "\"";
+                }
+                std::cerr << "." << std::endl;
+                printOutputDifference(expectedOutput, actualOutput);
+                stopProgram(process);
+                return REPLAY_OUTPUT_MISMATCH;
+            }
+        }
+
+        double sessionMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - sessionStart).count();
+        if (run == 0 || sessionMilliseconds < totalMilliseconds) {
+            totalMilliseconds = sessionMilliseconds;
+        }
+        stopProgram(process);
+    }
+
+    // Summarize screen latencies.
+    std::vector<double> sortedMilliseconds = screenMilliseconds;
+    std::sort(sortedMilliseconds.begin(), sortedMilliseconds.end());
+    std::vector<double>::size_type slowestScreen = std::max_element(screenMilliseconds.begin(), screenMilliseconds.end()) - screenMilliseconds.begin();
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Screens: " << steps.size() << " (" << runCount << (runCount == 1 ? " run" : " runs, fastest of each") << ")" << std::endl;
+    std::cout << "Session: " << totalMilliseconds << " ms" << std::endl;
+    std::cout << "Screen median: " << sortedMilliseconds[sortedMilliseconds.size() / 2] << " ms" << std::endl;
+    std::cout << "Screen p95: " << sortedMilliseconds[(sortedMilliseconds.size() - 1) * 95 / 100] << " ms" << std::endl;
+    std::cout << "Screen max: " << sortedMilliseconds.back() << " ms (screen " << slowestScreen;
+    if (steps[slowestScreen].hasInput) {
+        std::cout << ", input \"" << steps[slowestScreen].input << "\"";
+    }
+    std::cout << ")" << std::endl;
+
+    // Determine if latency is within budget.
+    int result = REPLAY_SUCCESS;
+    if (screenBudgetMilliseconds > 0 && sortedMilliseconds.back() > screenBudgetMilliseconds) {
+        std::cout << "Slowest screen exceeds budget of " << screenBudgetMilliseconds << " ms." << std::endl;
+        result = REPLAY_OVER_BUDGET;
+    }
+    if (totalBudgetMilliseconds > 0 && totalMilliseconds > totalBudgetMilliseconds) {
+        std::cout << "Session exceeds budget of " << totalBudgetMilliseconds << " ms." << std::endl;
+        result = REPLAY_OVER_BUDGET;
+    }
+
+    // Determine if each screen is within its allowance over the recording.
+    if (maxSlowdown > 0) {
+        for (std::vector<sessionStep>::size_type i = 0; i < steps.size(); ++i) {
+            if (steps[i].recordedMilliseconds < 0) {
+                continue;
+            }
+            double allowedMilliseconds = steps[i].recordedMilliseconds * maxSlowdown + slowdownMarginMilliseconds;
+            if (screenMilliseconds[i] > allowedMilliseconds) {
+                std::cout << "Screen " << i;
+                if (steps[i].hasInput) {
+                    std::cout << " (input \"" << steps[i].input << "\")";
+                }
+                std::cout << " takes " << screenMilliseconds[i] << " ms, over " << allowedMilliseconds << " ms allowed from " << steps[i].recordedMilliseconds << " ms recorded." << std::endl;
+                result = REPLAY_OVER_BUDGET;
+            }
+        }
+    }
+    if (result == REPLAY_SUCCESS) {
+        std::cout << "Output matches recording and latency is within budget." << std::endl;
+    }
+
+    return result;
+}
+
+/**
+ * @brief printOutputDifference prints the first line that differs between the recorded and actual output.
+ * @param expectedOutput = Output in the recording
+ * @param actualOutput = Output of the program
+ */
+
+void printOutputDifference(const std::string &expectedOutput, const std::string &actualOutput) {
+    std::istringstream expectedISS(expectedOutput);
+    std::istringstream actualISS(actualOutput);
+    std::string expectedLine;
+    std::string actualLine;
+
+    for (int lineNumber = 1; ; ++lineNumber) {
+        bool hasExpectedLine = static_cast<bool>(std::getline(expectedISS, expectedLine));
+        bool hasActualLine = static_cast<bool>(std::getline(actualISS, actualLine));
+        if (!hasExpectedLine && !hasActualLine) {
+            break;
+        }
+        if (!hasExpectedLine || !hasActualLine || expectedLine != actualLine) {
+            std::cerr << "Line " << lineNumber << " expected: " << (hasExpectedLine ? expectedLine : "(end of screen)") << std::endl;
+            std::cerr << "Line " << lineNumber << " actual:   " << (hasActualLine ? actualLine : "(end of screen)") << std::endl;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief maskExpiryTimes replaces each expiry countdown (hours and minutes such as "3h 05m", with the padding before
+ *        it) with a fixed marker, so screens recorded at different times compare equal.
+ * @param screenOutput = Screen's output
+ * @return = String with countdowns masked
+ */
+
+std::string maskExpiryTimes(const std::string &screenOutput) {
+    std::string maskedOutput;
+    std::string::size_type copiedEnd = 0;
+
+    for (std::string::size_type i = 0; i < screenOutput.size(); ++i) {
+        // Match digits, "h ", two digits, and "m" starting at a digit that does not follow another.
+        if (!std::isdigit(static_cast<unsigned char>(screenOutput[i])) || (i > 0 && std::isdigit(static_cast<unsigned char>(screenOutput[i - 1])))) {
+            continue;
+        }
+        std::string::size_type timeEnd = i;
+        while (timeEnd < screenOutput.size() && std::isdigit(static_cast<unsigned char>(screenOutput[timeEnd]))) {
+            ++timeEnd;
+        }
+        if (screenOutput.compare(timeEnd, 2, "h ") != 0 || timeEnd + 5 > screenOutput.size() || !std::isdigit(static_cast<unsigned char>(screenOutput[timeEnd + 2])) || !std::isdigit(static_cast<unsigned char>(screenOutput[timeEnd + 3])) || screenOutput[timeEnd + 4] != 'm') {
+            continue;
+        }
+
+        // Drop the padding too, since its width changes with the number of hour digits.
+        std::string::size_type timeStart = i;
+        while (timeStart > copiedEnd && screenOutput[timeStart - 1] == ' ') {
+            --timeStart;
+        }
+        maskedOutput.append(screenOutput, copiedEnd, timeStart - copiedEnd);
+        maskedOutput += " [expiry]";
+        copiedEnd = timeEnd + 5;
+        i = copiedEnd - 1;
+    }
+    maskedOutput.append(screenOutput, copiedEnd, std::string::npos);
+
+    return maskedOutput;
+}
+
+/**
+ * @brief saveSession writes a session file: the header line, then for each step an "input" line (except the first
+ *        step) and an "output" line giving the byte count of the screen that follows it and its recorded milliseconds.
+ * @param steps = Steps of the session
+ * @param sessionPath = Path of session file to write
+ * @return = Boolean indicating whether the file was written
+ */
+
+bool saveSession(const std::vector<sessionStep> &steps, const char *sessionPath) {
+    std::ofstream sessionFile(sessionPath, std::ios::binary);
+    sessionFile << SESSION_FILE_HEADER << "\n";
+    for (std::vector<sessionStep>::size_type i = 0; i < steps.size(); ++i) {
+        if (steps[i].hasInput) {
+            sessionFile << "input " << steps[i].input << "\n";
+        }
+        sessionFile << "output " << steps[i].output.size() << " " << steps[i].recordedMilliseconds << "\n" << steps[i].output << "\n";
+    }
+
+    return static_cast<bool>(sessionFile);
+}
+
+/**
+ * @brief loadSession reads a session file written by saveSession(), or one written before screens were timed.
+ * @param steps = Vector to receive steps of the session passed by reference
+ * @param sessionPath = Path of session file to read
+ * @return = Boolean indicating whether the file was read and well formed
+ */
+
+bool loadSession(std::vector<sessionStep> &steps, const char *sessionPath) {
+    std::ifstream sessionFile(sessionPath, std::ios::binary);
+    std::string line;
+    if (!std::getline(sessionFile, line) || (line != SESSION_FILE_HEADER && line != UNTIMED_SESSION_FILE_HEADER)) {
+        return false;
+    }
+    bool isTimed = line == SESSION_FILE_HEADER;
+
+    steps.clear();
+    sessionStep step;
+    step.hasInput = false;
+    step.recordedMilliseconds = -1.0;
+    while (std::getline(sessionFile, line)) {
+        if (line.compare(0, 6, "input ") == 0 && !step.hasInput) {
+            step.hasInput = true;
+            step.input = line.substr(6);
+        } else if (line.compare(0, 7, "output ") == 0 && (step.hasInput || steps.empty())) {
+            char *sizeEnd = nullptr;
+            std::string::size_type outputSize = std::strtoul(line.c_str() + 7, &sizeEnd, 10);
+            if (isTimed) {
+                char *timeEnd = nullptr;
+                step.recordedMilliseconds = std::strtod(sizeEnd, &timeEnd);
+                if (timeEnd == sizeEnd || *timeEnd != '\0') {
+                    return false;
+                }
+            }
+            step.output.assign(outputSize, '\0');
+            if (!sessionFile.read(&step.output[0], outputSize) || sessionFile.get() != '\n') {
+                return false;
+            }
+            steps.push_back(step);
+            step.hasInput = false;
+            step.input.clear();
+        } else {
+            return false;
+        }
+    }
+
+    return !steps.empty() && !step.hasInput;
+}
+
+#ifdef __unix__
+/**
+ * @brief startProgram starts the program with stdin and stdout on pipes, stderr discarded, full rendering so output
+ *        is the same on every run, and its prompts marked. It runs in a new temporary directory holding its fixture configuration and export
+ *        file, and publishes inventory under a name of its own.
+ * @param process = Process to receive the running program passed by reference
+ * @param programArguments = Null-terminated program path and arguments
+ * @param fixturePath = Configuration file to run the program with, or null for built-in defaults
+ * @return = Boolean indicating whether the program started
+ */
+
+bool startProgram(programProcess &process, char **programArguments, const char *fixturePath) {
+    // Create the run's working directory.
+    const char *temporaryDirectory = std::getenv("TMPDIR");
+    std::string directoryTemplate = std::string(temporaryDirectory != nullptr && temporaryDirectory[0] != '\0' ? temporaryDirectory : "/tmp") + "/session_replay.XXXXXX";
+    if (mkdtemp(&directoryTemplate[0]) == nullptr) {
+        return false;
+    }
+    process.workingDirectory = directoryTemplate;
+    process.publicationName = "/rebel_food_truck_replay_" + std::to_string(getpid());
+    if (!writeFixtureConfiguration(process.workingDirectory, fixturePath)) {
+        removeWorkingDirectory(process.workingDirectory);
+        return false;
+    }
+
+    // Keep a relative program path pointing at the same program once the working directory changes.
+    std::string programPath = programArguments[0];
+    char currentDirectory[PATH_MAX];
+    if (programPath[0] != '/' && programPath.find('/') != std::string::npos && getcwd(currentDirectory, sizeof(currentDirectory)) != nullptr) {
+        programPath = std::string(currentDirectory) + "/" + programPath;
+    }
+
+    int inputPipe[2];
+    int outputPipe[2];
+    if (pipe(inputPipe) != 0) {
+        removeWorkingDirectory(process.workingDirectory);
+        return false;
+    }
+    if (pipe(outputPipe) != 0) {
+        close(inputPipe[0]);
+        close(inputPipe[1]);
+        removeWorkingDirectory(process.workingDirectory);
+        return false;
+    }
+
+    // Report a program that exits early as a failed write instead of being killed by SIGPIPE.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    process.processId = fork();
+    if (process.processId == 0) {
+        dup2(inputPipe[0], STDIN_FILENO);
+        dup2(outputPipe[1], STDOUT_FILENO);
+        int nullDescriptor = open("/dev/null", O_WRONLY);
+        if (nullDescriptor >= 0) {
+            dup2(nullDescriptor, STDERR_FILENO);
+            close(nullDescriptor);
+        }
+        close(inputPipe[0]);
+        close(inputPipe[1]);
+        close(outputPipe[0]);
+        close(outputPipe[1]);
+        if (chdir(process.workingDirectory.c_str()) != 0) {
+            _exit(127);
+        }
+        setenv(TERMINAL_RENDER_MODE_VARIABLE, "full", 1);
+        setenv(TERMINAL_PROMPT_MARKER_VARIABLE, "1", 1);
+        setenv("REBEL_FOOD_TRUCK_PUBLICATION", process.publicationName.c_str(), 1);
+        execvp(programPath.c_str(), programArguments);
+        _exit(127);
+    }
+
+    close(inputPipe[0]);
+    close(outputPipe[1]);
+    if (process.processId < 0) {
+        close(inputPipe[1]);
+        close(outputPipe[0]);
+        removeWorkingDirectory(process.workingDirectory);
+        return false;
+    }
+    process.inputDescriptor = inputPipe[1];
+    process.outputDescriptor = outputPipe[0];
+
+    return true;
+}
+
+/**
+ * @brief writeInputLine sends a line of input to the program as if entered by the operator.
+ * @param process = Running program passed by reference
+ * @param inputLine = Line without its newline
+ * @return = Boolean indicating whether the whole line was sent
+ */
+
+bool writeInputLine(programProcess &process, const std::string &inputLine) {
+    std::string programInput = inputLine + "\n";
+
+    return write(process.inputDescriptor, programInput.data(), programInput.size()) == static_cast<ssize_t>(programInput.size());
+}
+
+/**
+ * @brief readScreen reads output until the program waits at a prompt, which the program marks by writing
+ *        TERMINAL_PROMPT_MARKER after it, or until the program exits.
+ * @param process = Running program passed by reference
+ * @param screenOutput = String to receive the screen's output, without the marker, passed by reference
+ * @return = Boolean indicating whether the program is still running at a prompt
+ */
+
+bool readScreen(programProcess &process, std::string &screenOutput) {
+    screenOutput.clear();
+
+    char outputBuffer[4096];
+    for (;;) {
+        if (!screenOutput.empty() && screenOutput[screenOutput.size() - 1] == TERMINAL_PROMPT_MARKER) {
+            screenOutput.erase(screenOutput.size() - 1);
+            return true;
+        }
+
+        pollfd outputPoll = { process.outputDescriptor, POLLIN, 0 };
+        int pollResult = poll(&outputPoll, 1, SCREEN_TIMEOUT_MILLISECONDS);
+        if (pollResult == 0) {
+            std::cerr << "Program produced no prompt for " << SCREEN_TIMEOUT_MILLISECONDS << " ms." << std::endl;
+            return false;
+        } else if (pollResult < 0) {
+            return false;
+        }
+
+        ssize_t outputLength = read(process.outputDescriptor, outputBuffer, sizeof(outputBuffer));
+        if (outputLength <= 0) {
+            return false;
+        }
+        screenOutput.append(outputBuffer, static_cast<std::string::size_type>(outputLength));
+    }
+}
+
+/**
+ * @brief writeFixtureConfiguration writes the configuration file the program reads from its working directory: a copy of
+ *        the fixture, if any, followed by a line sending the sales export into the working directory.
+ * @param workingDirectory = Run's working directory
+ * @param fixturePath = Configuration file to copy, or null for built-in defaults
+ * @return = Boolean indicating whether the fixture was read and the configuration written
+ */
+
+bool writeFixtureConfiguration(const std::string &workingDirectory, const char *fixturePath) {
+    std::ofstream configurationFile(workingDirectory + "/" + FIXTURE_CONFIGURATION_NAME, std::ios::binary);
+    if (fixturePath != nullptr) {
+        std::ifstream fixtureFile(fixturePath, std::ios::binary);
+        if (!fixtureFile) {
+            std::cerr << "Unable to read configuration " << fixturePath << "." << std::endl;
+            return false;
+        }
+        configurationFile << fixtureFile.rdbuf();
+    }
+
+    // Later keys replace earlier ones, so this overrides any export path in the fixture.
+    configurationFile << "\n" << FIXTURE_EXPORT_LINE << "\n";
+
+    return static_cast<bool>(configurationFile);
+}
+
+/**
+ * @brief removeWorkingDirectory removes a run's working directory and the files the run left in it.
+ * @param workingDirectory = Run's working directory
+ */
+
+void removeWorkingDirectory(const std::string &workingDirectory) {
+    DIR *directory = opendir(workingDirectory.c_str());
+    if (directory != nullptr) {
+        for (dirent *entry = readdir(directory); entry != nullptr; entry = readdir(directory)) {
+            if (std::strcmp(entry->d_name, ".") != 0 && std::strcmp(entry->d_name, "..") != 0) {
+                unlink((workingDirectory + "/" + entry->d_name).c_str());
+            }
+        }
+        closedir(directory);
+    }
+    rmdir(workingDirectory.c_str());
+}
+
+/**
+ * @brief stopProgram closes the program's input, waits briefly for it to exit, and kills it otherwise (the program keeps
+ *        prompting when its input ends before it quits). The run's publication and working directory are removed.
+ * @param process = Running program passed by reference
+ */
+
+void stopProgram(programProcess &process) {
+    close(process.inputDescriptor);
+
+    int exitStatus = 0;
+    std::chrono::steady_clock::time_point stopStart = std::chrono::steady_clock::now();
+    while (waitpid(process.processId, &exitStatus, WNOHANG) == 0) {
+        if (std::chrono::steady_clock::now() - stopStart > std::chrono::milliseconds(EXIT_TIMEOUT_MILLISECONDS)) {
+            kill(process.processId, SIGKILL);
+            waitpid(process.processId, &exitStatus, 0);
+            break;
+        }
+
+        // Drain output so a program still writing cannot block on a full pipe.
+        char outputBuffer[4096];
+        pollfd outputPoll = { process.outputDescriptor, POLLIN, 0 };
+        if (poll(&outputPoll, 1, 1) > 0 && read(process.outputDescriptor, outputBuffer, sizeof(outputBuffer)) <= 0) {
+            usleep(1000);
+        }
+    }
+
+    close(process.outputDescriptor);
+
+    // A killed program leaves its publication behind.
+    shm_unlink(process.publicationName.c_str());
+    removeWorkingDirectory(process.workingDirectory);
+}
+#else
+bool startProgram(programProcess &, char **, const char *) {
+    return false;
+}
+
+bool writeInputLine(programProcess &, const std::string &) {
+    return false;
+}
+
+bool readScreen(programProcess &, std::string &) {
+    return false;
+}
+
+void stopProgram(programProcess &) {
+}
+
+bool writeFixtureConfiguration(const std::string &, const char *) {
+    return false;
+}
+
+void removeWorkingDirectory(const std::string &) {
+}
+#endif
@@ -0,0 +1,19 @@
+QT -= gui core
+
+CONFIG += c++11 console
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ..
+
+SOURCES += \
+    session_replay.cpp
+
+HEADERS += \
+    ../terminal_renderer.h
+
+unix:!macx: LIBS += -lrt
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,369 @@
+//================================================================================
+// Name        : terminal_renderer.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Redraws menu tables on a terminal by sending only the cells
+//               that changed since the last frame
+//================================================================================
+
+#include "terminal_renderer.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifdef __unix__
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+// Unchanged cells between two changed runs are rewritten instead of skipped when shorter than a cursor move.
+static const std::string::size_type MIN_CURSOR_MOVE_GAP = 6;
+
+static void writeTerminalText(terminalScreen &screen, const std::string &text);
+static void splitFrameRows(std::vector<std::string> &frameRows, const std::string &frameText);
+static bool getTerminalSize(std::string::size_type &rowCount, std::string::size_type &columnCount);
+static bool isFrameFittingTerminal(const std::vector<std::string> &frameRows);
+static std::string::size_type countTerminalRows(const std::string &text);
+static void appendCursorMove(std::string &output, std::string::size_type row, std::string::size_type column);
+
+/**
+ * @brief initializeTerminalScreen chooses full or differential output and prints the header in full mode.
+ *        Differential mode is used when stdout is a terminal that understands ANSI escape sequences.
+ * @param screen = Screen state to initialize passed by reference
+ * @param header = Text shown above every table (printed once in full mode)
+ */
+
+void initializeTerminalScreen(terminalScreen &screen, const std::string &header) {
+    const char *renderMode = std::getenv(TERMINAL_RENDER_MODE_VARIABLE);
+    const char *terminalType = std::getenv("TERM");
+
+    // Determine render mode.
+    if (renderMode != nullptr && std::strcmp(renderMode, "differential") == 0) {
+        screen.isDifferential = true;
+    } else if (renderMode != nullptr && std::strcmp(renderMode, "full") == 0) {
+        screen.isDifferential = false;
+    } else {
+#ifdef __unix__
+        screen.isDifferential = isatty(STDOUT_FILENO) && terminalType != nullptr && std::strcmp(terminalType, "dumb") != 0;
+#else
+        screen.isDifferential = false;
+#endif
+    }
+
+    screen.isDrawn = false;
+    screen.isCountingBytes = std::getenv(TERMINAL_RENDER_STATS_VARIABLE) != nullptr;
+    screen.isMarkingPrompts = std::getenv(TERMINAL_PROMPT_MARKER_VARIABLE) != nullptr;
+    screen.header = header;
+    screen.pendingMessages.clear();
+    screen.drawnRows.clear();
+    screen.promptRows = 0;
+    screen.frameCount = 0;
+    screen.bytesWritten = 0;
+    screen.fullModeBytes = header.size() + 1;
+
+    if (!screen.isDifferential) {
+        std::cout << header << std::endl;
+        screen.bytesWritten += header.size() + 1;
+    }
+}
+
+/**
+ * @brief printTerminalMessage prints a status message. In differential mode, the message is held and drawn below the
+ *        next table so the redraw does not erase it.
+ * @param screen = Screen state passed by reference
+ * @param message = Message text including any line breaks
+ */
+
+void printTerminalMessage(terminalScreen &screen, const std::string &message) {
+    if (screen.isDifferential) {
+        screen.pendingMessages += message;
+        screen.fullModeBytes += message.size();
+    } else {
+        writeTerminalText(screen, message);
+    }
+}
+
+/**
+ * @brief printTerminalPrompt prints a prompt below the table and leaves the cursor after it for the operator's input.
+ *        The prompt is followed by TERMINAL_PROMPT_MARKER when TERMINAL_PROMPT_MARKER_VARIABLE is set.
+ * @param screen = Screen state passed by reference
+ * @param prompt = Prompt text, ending where input starts
+ */
+
+void printTerminalPrompt(terminalScreen &screen, const std::string &prompt) {
+    writeTerminalText(screen, prompt);
+    if (screen.isMarkingPrompts) {
+        std::cout << TERMINAL_PROMPT_MARKER << std::flush;
+    }
+
+    // The line entered ends with the operator's Enter, which moves to the next row.
+    screen.promptRows += countTerminalRows(prompt) + 1;
+}
+
+/**
+ * @brief printTerminalPromptMessage prints a message answering input at a prompt (such as a validation error) right
+ *        away, below the prompt.
+ * @param screen = Screen state passed by reference
+ * @param message = Message text including any line breaks
+ */
+
+void printTerminalPromptMessage(terminalScreen &screen, const std::string &message) {
+    writeTerminalText(screen, message);
+    screen.promptRows += countTerminalRows(message);
+}
+
+/**
+ * @brief printTerminalError prints an error to stderr right away. Standard error usually shares the terminal, so its
+ *        rows are counted like a prompt message's.
+ * @param screen = Screen state passed by reference
+ * @param message = Message text including any line breaks
+ */
+
+void printTerminalError(terminalScreen &screen, const std::string &message) {
+    std::cout.flush();
+    std::cerr << message << std::flush;
+    screen.promptRows += countTerminalRows(message);
+}
+
+/**
+ * @brief drawTerminalFrame prints a table. In full mode, the table text is printed as is. In differential mode, the
+ *        frame is compared with the last frame drawn cell by cell, only changed runs of cells are sent with cursor moves,
+ *        and everything below the frame (the previous prompt and input) is cleared so the next prompt starts there. A
+ *        frame too tall or wide for the terminal would scroll it away from the grid, so it is printed as in full mode
+ *        and the next frame that fits is drawn from a cleared screen, as is a frame after prompts and their messages
+ *        reached the bottom of the terminal and scrolled the last frame.
+ * @param screen = Screen state passed by reference
+ * @param tableText = Table text with one line per row
+ */
+
+void drawTerminalFrame(terminalScreen &screen, const std::string &tableText) {
+    ++screen.frameCount;
+    screen.fullModeBytes += tableText.size();
+
+    if (!screen.isDifferential) {
+        std::cout << tableText << std::flush;
+        screen.bytesWritten += tableText.size();
+        return;
+    }
+
+    // Build frame cell grid.
+    std::vector<std::string> frameRows;
+    splitFrameRows(frameRows, screen.header + "\n" + tableText + screen.pendingMessages);
+
+    // Print a frame that does not fit without cursor moves.
+    if (!isFrameFittingTerminal(frameRows)) {
+        std::cout << tableText << screen.pendingMessages << std::flush;
+        screen.bytesWritten += tableText.size() + screen.pendingMessages.size();
+        screen.pendingMessages.clear();
+        screen.isDrawn = false;
+        return;
+    }
+    screen.pendingMessages.clear();
+
+    // Rows below the last frame that reached the bottom of the terminal scrolled it out of place.
+    std::string::size_type terminalRowCount = 0;
+    std::string::size_type terminalColumnCount = 0;
+    if (screen.isDrawn && getTerminalSize(terminalRowCount, terminalColumnCount) && screen.drawnRows.size() + screen.promptRows >= terminalRowCount) {
+        screen.isDrawn = false;
+    }
+    screen.promptRows = 0;
+
+    std::string output;
+
+    // Clear terminal before first frame so the grid starts from a known state.
+    if (!screen.isDrawn) {
+        output += "\033[H\033[2J";
+        screen.drawnRows.clear();
+        screen.isDrawn = true;
+    }
+
+    for (std::string::size_type row = 0; row < frameRows.size(); ++row) {
+        const std::string &newRow = frameRows[row];
+        const std::string emptyRow;
+        const std::string &oldRow = row < screen.drawnRows.size() ? screen.drawnRows[row] : emptyRow;
+
+        // Send each run of changed cells, merging runs separated by fewer unchanged cells than a cursor move costs.
+        std::string::size_type column = 0;
+        while (column < newRow.size()) {
+            if (column < oldRow.size() && newRow[column] == oldRow[column]) {
+                ++column;
+                continue;
+            }
+
+            std::string::size_type runEnd = column + 1;
+            std::string::size_type unchangedCount = 0;
+            for (std::string::size_type i = runEnd; i < newRow.size() && unchangedCount < MIN_CURSOR_MOVE_GAP; ++i) {
+                if (i < oldRow.size() && newRow[i] == oldRow[i]) {
+                    ++unchangedCount;
+                } else {
+                    unchangedCount = 0;
+                    runEnd = i + 1;
+                }
+            }
+
+            appendCursorMove(output, row, column);
+            output.append(newRow, column, runEnd - column);
+            column = runEnd;
+        }
+
+        // Erase cells left over from a longer row.
+        if (oldRow.size() > newRow.size()) {
+            appendCursorMove(output, row, newRow.size());
+            output += "\033[K";
+        }
+    }
+
+    // Clear everything below the frame, including rows of a taller previous frame, and leave the cursor there.
+    appendCursorMove(output, frameRows.size(), 0);
+    output += "\033[J";
+
+    std::cout.write(output.data(), output.size());
+    std::cout.flush();
+    screen.bytesWritten += output.size();
+
+    screen.drawnRows.swap(frameRows);
+}
+
+/**
+ * @brief reportTerminalStatistics prints to stderr how many frames were drawn and how many bytes were written to stdout,
+ *        next to the bytes full mode would have written, when TERMINAL_RENDER_STATS_VARIABLE is set.
+ * @param screen = Screen state
+ */
+
+void reportTerminalStatistics(const terminalScreen &screen) {
+    if (!screen.isCountingBytes) {
+        return;
+    }
+
+    std::cerr << "Frames drawn: " << screen.frameCount << ". Bytes written: " << screen.bytesWritten << " (" << (screen.isDifferential ? "differential" : "full") << " mode); full mode: " << screen.fullModeBytes << "." << std::endl;
+}
+
+/**
+ * @brief writeTerminalText writes text that is the same in either mode to stdout right away and counts it.
+ * @param screen = Screen state passed by reference
+ * @param text = Text to write
+ */
+
+static void writeTerminalText(terminalScreen &screen, const std::string &text) {
+    std::cout << text << std::flush;
+    screen.bytesWritten += text.size();
+    screen.fullModeBytes += text.size();
+}
+
+/**
+ * @brief splitFrameRows splits frame text into rows at line breaks. A final line break does not start another row.
+ * @param frameRows = Vector of strings to receive rows passed by reference
+ * @param frameText = Frame text
+ */
+
+static void splitFrameRows(std::vector<std::string> &frameRows, const std::string &frameText) {
+    std::string::size_type rowStart = 0;
+    while (rowStart < frameText.size()) {
+        std::string::size_type rowEnd = frameText.find('\n', rowStart);
+        if (rowEnd == std::string::npos) {
+            rowEnd = frameText.size();
+        }
+        frameRows.push_back(frameText.substr(rowStart, rowEnd - rowStart));
+        rowStart = rowEnd + 1;
+    }
+}
+
+/**
+ * @brief isFrameFittingTerminal determines if a frame and the prompt below it fit on the terminal without scrolling or
+ *        wrapping. A terminal whose size is unknown is assumed to fit.
+ * @param frameRows = Rows of the frame
+ * @return = Boolean indicating whether the frame fits
+ */
+
+static bool isFrameFittingTerminal(const std::vector<std::string> &frameRows) {
+    std::string::size_type terminalRowCount = 0;
+    std::string::size_type terminalColumnCount = 0;
+    if (!getTerminalSize(terminalRowCount, terminalColumnCount)) {
+        return true;
+    }
+
+    // The prompt takes the row below the frame.
+    if (frameRows.size() + 1 > terminalRowCount) {
+        return false;
+    }
+    for (std::string::size_type row = 0; row < frameRows.size(); ++row) {
+        if (frameRows[row].size() > terminalColumnCount) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief getTerminalSize gets the number of rows and columns of the terminal on stdout.
+ * @param rowCount = Integer to receive the number of rows passed by reference
+ * @param columnCount = Integer to receive the number of columns passed by reference
+ * @return = Boolean indicating whether the size is known
+ */
+
+static bool getTerminalSize(std::string::size_type &rowCount, std::string::size_type &columnCount) {
+#ifdef __unix__
+    struct winsize terminalSize;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &terminalSize) != 0 || terminalSize.ws_row == 0 || terminalSize.ws_col == 0) {
+        return false;
+    }
+    rowCount = terminalSize.ws_row;
+    columnCount = terminalSize.ws_col;
+
+    return true;
+#else
+    (void)rowCount;
+    (void)columnCount;
+
+    return false;
+#endif
+}
+
+/**
+ * @brief countTerminalRows counts the rows text moves the cursor down by: one per line break, plus one for each time a
+ *        line wraps at the terminal's width.
+ * @param text = Text written
+ * @return = Number of rows
+ */
+
+static std::string::size_type countTerminalRows(const std::string &text) {
+    std::string::size_type terminalRowCount = 0;
+    std::string::size_type terminalColumnCount = 0;
+    const bool isSizeKnown = getTerminalSize(terminalRowCount, terminalColumnCount);
+
+    std::string::size_type rowCount = 0;
+    std::string::size_type lineStart = 0;
+    for (std::string::size_type i = 0; i <= text.size(); ++i) {
+        if (i == text.size() || text[i] == '\n') {
+            if (isSizeKnown && i - lineStart > terminalColumnCount) {
+                rowCount += (i - lineStart - 1) / terminalColumnCount;
+            }
+            if (i < text.size()) {
+                ++rowCount;
+            }
+            lineStart = i + 1;
+        }
+    }
+
+    return rowCount;
+}
+
+/**
+ * @brief appendCursorMove appends an ANSI cursor position sequence for a zero-based row and column.
+ * @param output = Output string passed by reference
+ * @param row = Zero-based row
+ * @param column = Zero-based column
+ */
+
+static void appendCursorMove(std::string &output, std::string::size_type row, std::string::size_type column) {
+    output += "\033[";
+    output += std::to_string(row + 1);
+    if (column > 0) {
+        output += ";";
+        output += std::to_string(column + 1);
+    }
+    output += "H";
+}
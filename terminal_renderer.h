@@ -0,0 +1,54 @@
+//================================================================================
+// Name        : terminal_renderer.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Redraws menu tables on a terminal by sending only the cells
+//               that changed since the last frame
+//================================================================================
+
+#ifndef TERMINAL_RENDERER_H
+#define TERMINAL_RENDERER_H
+
+#include <string>
+#include <vector>
+
+// Environment variable overriding render mode detection ("full" or "differential").
+#define TERMINAL_RENDER_MODE_VARIABLE "REBEL_FOOD_TRUCK_RENDER"
+
+// Environment variable that, when set, makes the program report at quit how many bytes it wrote to stdout and how many
+// full mode would have written for the same session.
+#define TERMINAL_RENDER_STATS_VARIABLE "REBEL_FOOD_TRUCK_RENDER_STATS"
+
+// Environment variable that, when set, makes every prompt end with TERMINAL_PROMPT_MARKER once it is written, so a
+// program driving the menus (such as session_replay) knows where each screen ends.
+#define TERMINAL_PROMPT_MARKER_VARIABLE "REBEL_FOOD_TRUCK_PROMPT_MARKER"
+#define TERMINAL_PROMPT_MARKER '\x1e'
+
+// Screen state. In differential mode, the header, the latest table, and any messages printed since the previous table
+// form a frame anchored at the top of the terminal, and drawnRows holds the cell grid of the frame last sent. Prompts,
+// the lines entered at them, and their messages take the rows below the frame; promptRows counts them so a frame is
+// drawn from a cleared screen once they may have scrolled the terminal. All output goes through these functions.
+struct terminalScreen {
+    bool isDifferential;
+    bool isDrawn;
+    bool isCountingBytes;
+    bool isMarkingPrompts;
+    std::string header;
+    std::string pendingMessages;
+    std::vector<std::string> drawnRows;
+    std::string::size_type promptRows;
+    unsigned long long frameCount;
+    unsigned long long bytesWritten;
+    unsigned long long fullModeBytes;
+};
+
+void initializeTerminalScreen(terminalScreen &screen, const std::string &header);
+void printTerminalMessage(terminalScreen &screen, const std::string &message);
+void printTerminalPrompt(terminalScreen &screen, const std::string &prompt);
+void printTerminalPromptMessage(terminalScreen &screen, const std::string &message);
+void printTerminalError(terminalScreen &screen, const std::string &message);
+void drawTerminalFrame(terminalScreen &screen, const std::string &tableText);
+void reportTerminalStatistics(const terminalScreen &screen);
+
+#endif // TERMINAL_RENDERER_H
@@ -0,0 +1,86 @@
+//================================================================================
+// Name        : catalog_test.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Tests of catalog codes and recipes
+//================================================================================
+
+#include "catalog.h"
+#include "test_check.h"
+
+/**
+ * @brief runCatalogTests checks which codes, capacities, and recipe amounts a catalog accepts, and how restocks are
+ *        kept as lots.
+ */
+
+void runCatalogTests() {
+    truckCatalog catalog;
+    clearCatalog(catalog);
+    TEST_CHECK(addCatalogIngredient(catalog, "PATTY", "Patties", "patty", "", 100) == CATALOG_SUCCESS);
+    TEST_CHECK(addCatalogIngredient(catalog, "BUN", "Buns", "bun", "", 100) == CATALOG_SUCCESS);
+
+    // Page commands are never codes, in either case.
+    const char *pageCommandCodes[] = { "N", "n", "P", "p" };
+    for (const char *pageCommandCode : pageCommandCodes) {
+        TEST_CHECK(addCatalogIngredient(catalog, pageCommandCode, "Label", "name", "", 10) == CATALOG_INVALID_CODE);
+        TEST_CHECK(addCatalogItem(catalog, pageCommandCode, "Label", "names", 1.00, "PATTY:1") == CATALOG_INVALID_CODE);
+    }
+    TEST_CHECK(addCatalogItem(catalog, "NP", "Label", "names", 1.00, "PATTY:1") == CATALOG_SUCCESS);
+
+    // Capacities are capped.
+    TEST_CHECK(addCatalogIngredient(catalog, "MAXCAP", "Label", "name", "", 1000000000) == CATALOG_SUCCESS);
+    TEST_CHECK(addCatalogIngredient(catalog, "OVERCAP", "Label", "name", "", 1000000001) == CATALOG_INVALID_VALUE);
+
+    // Recipe amounts are capped, including amounts of an ingredient listed twice, which are added together.
+    TEST_CHECK(addCatalogItem(catalog, "MAX", "Label", "names", 1.00, "PATTY:1000000") == CATALOG_SUCCESS);
+    TEST_CHECK(addCatalogItem(catalog, "OVER", "Label", "names", 1.00, "PATTY:1000001") == CATALOG_INVALID_RECIPE);
+    TEST_CHECK(addCatalogItem(catalog, "HUGE", "Label", "names", 1.00, "PATTY:9223372036854775807") == CATALOG_INVALID_RECIPE);
+    TEST_CHECK(addCatalogItem(catalog, "TWICE_OVER", "Label", "names", 1.00, "PATTY:600000 BUN:1 PATTY:600000") == CATALOG_INVALID_RECIPE);
+    TEST_CHECK(addCatalogItem(catalog, "TWICE", "Label", "names", 1.00, "PATTY:1 BUN:1 PATTY:2") == CATALOG_SUCCESS);
+    finalizeCatalog(catalog, 0.2);
+
+    const catalogItem &twiceItem = catalog.items[findCatalogItem(catalog, "TWICE")];
+    TEST_CHECK(twiceItem.recipeCount == 2);
+    TEST_CHECK(catalog.recipeComponents[twiceItem.recipeStart].amount == 3);
+    TEST_CHECK(catalog.recipeComponents[twiceItem.recipeStart + 1].amount == 1);
+    TEST_CHECK(findCatalogItem(catalog, "OVER") < 0 && findCatalogItem(catalog, "TWICE_OVER") < 0);
+
+    // Fill the lot queue with a restock each second after startup.
+    truckCatalog lotCatalog;
+    clearCatalog(lotCatalog);
+    TEST_CHECK(addCatalogIngredient(lotCatalog, "PATTY", "Patties", "patty", "", 2000, 100) == CATALOG_SUCCESS);
+    TEST_CHECK(addCatalogItem(lotCatalog, "BURGER", "Burger", "burgers", 1.00, "PATTY:1") == CATALOG_SUCCESS);
+    finalizeCatalog(lotCatalog, 0.2);
+
+    catalogInventory inventory;
+    initializeCatalogInventory(inventory, lotCatalog, 0);
+    for (std::int64_t currentTime = 1; currentTime < MAX_INGREDIENT_LOTS; ++currentTime) {
+        setIngredientInventory(inventory, lotCatalog, 0, inventory.ingredientInventories[0] + 1, currentTime);
+    }
+    const ingredientLotQueue &lotQueue = inventory.ingredientLots[0];
+    TEST_CHECK(lotQueue.count == static_cast<std::uint32_t>(MAX_INGREDIENT_LOTS));
+
+    // A restock of a full queue merges the two oldest lots, which keep the earlier expiry, and stays fresh itself.
+    setIngredientInventory(inventory, lotCatalog, 0, inventory.ingredientInventories[0] + 1, MAX_INGREDIENT_LOTS);
+    TEST_CHECK(lotQueue.count == static_cast<std::uint32_t>(MAX_INGREDIENT_LOTS));
+    TEST_CHECK(lotQueue.lots[lotQueue.head].quantity == 2001 && lotQueue.lots[lotQueue.head].expiryTime == 100);
+    TEST_CHECK(lotQueue.lots[(lotQueue.head + lotQueue.count - 1) % MAX_INGREDIENT_LOTS].expiryTime == 100 + MAX_INGREDIENT_LOTS);
+
+    // The merged lot expires on the oldest lot's schedule, and the restocks after it on their own.
+    std::vector<catalogExpiredStock> expiredStock;
+    expireCatalogInventory(inventory, lotCatalog, 100, expiredStock);
+    TEST_CHECK(expiredStock.size() == 1 && expiredStock[0].quantity == 2001);
+    TEST_CHECK(inventory.ingredientInventories[0] == MAX_INGREDIENT_LOTS - 1);
+    TEST_CHECK(getOldestLotExpiry(lotQueue) == 102);
+
+    // Restocks sold right away leave their expiries behind, which compaction keeps from piling up.
+    for (std::int64_t currentTime = 101; currentTime < 1101; ++currentTime) {
+        setIngredientInventory(inventory, lotCatalog, 0, inventory.ingredientInventories[0] + 1, currentTime);
+        sellCatalogItem(inventory, lotCatalog, 0, 1);
+    }
+    TEST_CHECK(inventory.lotExpiries.size() <= 4 * static_cast<std::size_t>(MAX_INGREDIENT_LOTS));
+    expireCatalogInventory(inventory, lotCatalog, 1200, expiredStock);
+    TEST_CHECK(expiredStock.size() == 1 && expiredStock[0].quantity == MAX_INGREDIENT_LOTS - 1);
+    TEST_CHECK(inventory.ingredientInventories[0] == 0 && lotQueue.count == 0);
+}
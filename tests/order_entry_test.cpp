@@ -0,0 +1,145 @@
+//================================================================================
+// Name        : order_entry_test.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Tests of single-line order entry
+//================================================================================
+
+#include <cstdint>
+
+#include "order_entry.h"
+#include "test_check.h"
+
+static void buildOrderTestCatalog(truckCatalog &catalog);
+static orderEntryError parseTestOrderLine(orderLine &order, const truckCatalog &catalog, const char *stringInput);
+static bool isTestOrderLine(const truckCatalog &catalog, const char *stringInput);
+static void fillTestPageItems(std::uint32_t (&pageItems)[MAX_ORDER_LINE_ITEMS], const truckCatalog &catalog);
+
+/**
+ * @brief runOrderEntryTests checks the order line forms given in the README and the sell prompt's comments, and lines
+ *        that must be rejected.
+ */
+
+void runOrderEntryTests() {
+    truckCatalog catalog;
+    buildOrderTestCatalog(catalog);
+    const std::int32_t BURGER_INDEX = findCatalogItem(catalog, "BURGER");
+    const std::int32_t DOG_INDEX    = findCatalogItem(catalog, "DOG");
+    orderLine order;
+
+    // Option numbers, with and without blanks around the 'x'
+    const char *optionLines[] = { "0x3 1x2", "0 x3 1 x2", "0 x 3, 1 x 2", "0x 3 1X2" };
+    for (const char *optionLine : optionLines) {
+        TEST_CHECK(isTestOrderLine(catalog, optionLine));
+        TEST_CHECK(parseTestOrderLine(order, catalog, optionLine) == ORDER_SUCCESS);
+        TEST_CHECK(order.itemCount == 2);
+        TEST_CHECK(order.itemIndexes[0] == static_cast<std::uint32_t>(BURGER_INDEX) && order.itemQuantities[0] == 3);
+        TEST_CHECK(order.itemIndexes[1] == static_cast<std::uint32_t>(DOG_INDEX) && order.itemQuantities[1] == 2);
+    }
+
+    // Codes, including the documented "BURGER x3 DOG x1"
+    const char *codeLines[] = { "BURGER x3 DOG x1", "BURGERx3 DOGx1", "burger x 3 dog x 1", "BURGERx 3,DOG x1" };
+    for (const char *codeLine : codeLines) {
+        TEST_CHECK(isTestOrderLine(catalog, codeLine));
+        TEST_CHECK(parseTestOrderLine(order, catalog, codeLine) == ORDER_SUCCESS);
+        TEST_CHECK(order.itemCount == 2);
+        TEST_CHECK(order.itemIndexes[0] == static_cast<std::uint32_t>(BURGER_INDEX) && order.itemQuantities[0] == 3);
+        TEST_CHECK(order.itemIndexes[1] == static_cast<std::uint32_t>(DOG_INDEX) && order.itemQuantities[1] == 1);
+    }
+
+    // Codes containing 'x' keep it as part of the code.
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BOX x2 XL x 4") == ORDER_SUCCESS);
+    TEST_CHECK(order.itemCount == 2 && order.itemQuantities[0] == 2 && order.itemQuantities[1] == 4);
+    TEST_CHECK(order.itemIndexes[0] == static_cast<std::uint32_t>(findCatalogItem(catalog, "BOX")));
+    TEST_CHECK(order.itemIndexes[1] == static_cast<std::uint32_t>(findCatalogItem(catalog, "XL")));
+
+    // An 'x' followed by digits inside a code is not a pair unless a whole code comes before it.
+    const char *boxLines[] = { "BOX2 x3", "BOX2x3", "box2 x 3" };
+    for (const char *boxLine : boxLines) {
+        TEST_CHECK(isTestOrderLine(catalog, boxLine));
+        TEST_CHECK(parseTestOrderLine(order, catalog, boxLine) == ORDER_SUCCESS);
+        TEST_CHECK(order.itemCount == 1 && order.itemQuantities[0] == 3);
+        TEST_CHECK(order.itemIndexes[0] == static_cast<std::uint32_t>(findCatalogItem(catalog, "BOX2")));
+    }
+
+    // Input with an 'x' that follows no whole code or option number is not an order line.
+    const char *otherLines[] = { "BOX2", "extra", "TACO x1", "9x1", "x3" };
+    for (const char *otherLine : otherLines) {
+        TEST_CHECK(!isTestOrderLine(catalog, otherLine));
+    }
+
+    // Repeated items are added together.
+    TEST_CHECK(parseTestOrderLine(order, catalog, "DOG x1 DOG x 2") == ORDER_SUCCESS);
+    TEST_CHECK(order.itemCount == 1 && order.itemQuantities[0] == 3);
+
+    // Lines to reject
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BURGER x") == ORDER_INVALID_SYNTAX);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BURGER 3") == ORDER_INVALID_SYNTAX);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BURGER x3 DOG") == ORDER_INVALID_SYNTAX);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BURGER x3, x1") == ORDER_INVALID_SYNTAX);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "BURGER x 3x") == ORDER_INVALID_SYNTAX);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "TACO x1") == ORDER_UNKNOWN_ITEM);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "9 x1") == ORDER_UNKNOWN_ITEM);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "DOG x 0") == ORDER_INVALID_QUANTITY);
+    TEST_CHECK(parseTestOrderLine(order, catalog, "DOG x 99999999999999999999") == ORDER_INVALID_QUANTITY);
+}
+
+/**
+ * @brief buildOrderTestCatalog builds a catalog whose first two items are BURGER and DOG, plus codes containing 'x'
+ *        (BOX2 looks like "BO x 2").
+ * @param catalog = Catalog to build passed by reference
+ */
+
+static void buildOrderTestCatalog(truckCatalog &catalog) {
+    clearCatalog(catalog);
+    addCatalogIngredient(catalog, "PATTY", "Patties", "patty", "", 100);
+    addCatalogIngredient(catalog, "BUN", "Buns", "bun", "", 100);
+    addCatalogItem(catalog, "BURGER", "Burger", "burgers", 5.00, "PATTY:1 BUN:1");
+    addCatalogItem(catalog, "DOG", "Dog", "dogs", 4.00, "BUN:1");
+    addCatalogItem(catalog, "BOX", "Box", "boxes", 9.00, "PATTY:2");
+    addCatalogItem(catalog, "XL", "Extra Large", "extra larges", 7.00, "PATTY:2 BUN:1");
+    addCatalogItem(catalog, "BOX2", "Box for Two", "boxes for two", 16.00, "PATTY:4");
+    finalizeCatalog(catalog, 0.2);
+}
+
+/**
+ * @brief parseTestOrderLine parses an order line against a sell page listing every item in catalog order.
+ * @param order = Order line to receive items and quantities passed by reference
+ * @param catalog = Catalog to look up items in
+ * @param stringInput = Null-terminated byte string constant of input
+ * @return = orderEntryError enum representing the result of parsing the order line
+ */
+
+static orderEntryError parseTestOrderLine(orderLine &order, const truckCatalog &catalog, const char *stringInput) {
+    std::uint32_t pageItems[MAX_ORDER_LINE_ITEMS];
+    fillTestPageItems(pageItems, catalog);
+
+    return parseOrderLine(order, stringInput, catalog, pageItems, static_cast<unsigned int>(catalog.items.size()));
+}
+
+/**
+ * @brief isTestOrderLine determines if input is an order line on a sell page listing every item in catalog order.
+ * @param catalog = Catalog to look up items in
+ * @param stringInput = Null-terminated byte string constant of input
+ * @return = Boolean indicating whether input is an order line
+ */
+
+static bool isTestOrderLine(const truckCatalog &catalog, const char *stringInput) {
+    std::uint32_t pageItems[MAX_ORDER_LINE_ITEMS];
+    fillTestPageItems(pageItems, catalog);
+
+    return isOrderLine(stringInput, catalog, pageItems, static_cast<unsigned int>(catalog.items.size()));
+}
+
+/**
+ * @brief fillTestPageItems lists every item of the catalog on one sell page, in catalog order.
+ * @param pageItems = Array to receive item indexes for each option number passed by reference
+ * @param catalog = Catalog to list
+ */
+
+static void fillTestPageItems(std::uint32_t (&pageItems)[MAX_ORDER_LINE_ITEMS], const truckCatalog &catalog) {
+    for (std::uint32_t i = 0; i < catalog.items.size(); ++i) {
+        pageItems[i] = i;
+    }
+}
@@ -0,0 +1,74 @@
+//================================================================================
+// Name        : sales_counters_test.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Tests of sharded sales counters under many selling threads
+//================================================================================
+
+#include <thread>
+#include <vector>
+
+#include "sales_counters.h"
+#include "test_check.h"
+
+// More selling threads than owned shards, so several threads share the shared shard
+static const unsigned int STRESS_THREAD_COUNT = 3 * SALES_COUNTER_SHARD_COUNT;
+static const std::uint32_t STRESS_ITEM_COUNT = 5;
+static const int STRESS_SALES_PER_THREAD = 200000;
+
+/**
+ * @brief runSalesCountersTests records sales from more threads than there are owned shards and checks that every sale
+ *        is counted exactly, and that threads release their shards of each set of counters when they exit.
+ */
+
+void runSalesCountersTests() {
+    salesCounters counters;
+    initializeSalesCounters(counters, STRESS_ITEM_COUNT);
+
+    // Each thread sells every item in turn. Thread t sells t + 1 of an item for 100 cents each.
+    std::vector<std::thread> sellers;
+    for (unsigned int t = 0; t < STRESS_THREAD_COUNT; ++t) {
+        sellers.push_back(std::thread([&counters, t]() {
+            for (int i = 0; i < STRESS_SALES_PER_THREAD; ++i) {
+                recordItemSale(counters, static_cast<std::uint32_t>(i) % STRESS_ITEM_COUNT, t + 1, 100 * (t + 1));
+            }
+        }));
+    }
+    for (unsigned int t = 0; t < STRESS_THREAD_COUNT; ++t) {
+        sellers[t].join();
+    }
+
+    // Quantity sold of each item is (1 + 2 + ... + threads) times the sales of that item per thread.
+    const std::int64_t THREAD_QUANTITY_SUM = static_cast<std::int64_t>(STRESS_THREAD_COUNT) * (STRESS_THREAD_COUNT + 1) / 2;
+    const std::int64_t SALES_PER_ITEM = STRESS_SALES_PER_THREAD / STRESS_ITEM_COUNT;
+    std::vector<std::int64_t> quantitiesSold;
+    std::vector<std::int64_t> revenuesCents;
+    mergeSalesCounters(quantitiesSold, revenuesCents, counters);
+    for (std::uint32_t i = 0; i < STRESS_ITEM_COUNT; ++i) {
+        TEST_CHECK(quantitiesSold[i] == THREAD_QUANTITY_SUM * SALES_PER_ITEM);
+        TEST_CHECK(revenuesCents[i] == 100 * THREAD_QUANTITY_SUM * SALES_PER_ITEM);
+    }
+    TEST_CHECK(getSalesRevenueCents(counters) == 100 * THREAD_QUANTITY_SUM * STRESS_SALES_PER_THREAD);
+
+    // Threads that exit give their shards back, so threads started later own shards again.
+    TEST_CHECK(counters.claims->claimedShards.load() == 0);
+    for (unsigned int t = 0; t < STRESS_THREAD_COUNT; ++t) {
+        std::thread([&counters]() {
+            recordItemSale(counters, 0, 1, 100);
+            TEST_CHECK(counters.claims->claimedShards.load() == 1);
+        }).join();
+    }
+    TEST_CHECK(counters.claims->claimedShards.load() == 0);
+
+    // Each set of counters is claimed on its own, so a thread owns a shard of each.
+    salesCounters otherCounters;
+    initializeSalesCounters(otherCounters, STRESS_ITEM_COUNT);
+    std::thread([&counters, &otherCounters]() {
+        recordItemSale(counters, 0, 1, 100);
+        recordItemSale(otherCounters, 0, 1, 100);
+        recordItemSale(counters, 0, 1, 100);
+        TEST_CHECK(counters.claims->claimedShards.load() == 1 && otherCounters.claims->claimedShards.load() == 1);
+    }).join();
+    TEST_CHECK(counters.claims->claimedShards.load() == 0 && otherCounters.claims->claimedShards.load() == 0);
+}
@@ -0,0 +1,42 @@
+//================================================================================
+// Name        : test_check.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Checks shared by the Rebel Food Truck tests
+//================================================================================
+
+#include "test_check.h"
+
+#include <atomic>
+#include <iostream>
+
+// Number of checks failed so far
+static std::atomic<int> testFailureCount(0);
+
+/**
+ * @brief checkTestCondition counts and prints a failed check.
+ * @param condition = Result of the check
+ * @param conditionText = Null-terminated byte string constant of the condition as written
+ * @param fileName = Null-terminated byte string constant of the file holding the check
+ * @param lineNumber = Line of the check
+ * @return = Boolean with the result of the check
+ */
+
+bool checkTestCondition(bool condition, const char *conditionText, const char *fileName, int lineNumber) {
+    if (!condition) {
+        ++testFailureCount;
+        std::cerr << fileName << ":" << lineNumber << ": check failed: " << conditionText << std::endl;
+    }
+
+    return condition;
+}
+
+/**
+ * @brief getTestFailureCount returns the number of checks failed so far.
+ * @return = Integer with number of failed checks
+ */
+
+int getTestFailureCount() {
+    return testFailureCount.load();
+}
@@ -0,0 +1,24 @@
+//================================================================================
+// Name        : test_check.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Checks shared by the Rebel Food Truck tests, and the test
+//               groups run by the test program
+//================================================================================
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+// Checks a condition, printing it with its file and line when it fails.
+#define TEST_CHECK(condition) checkTestCondition((condition), #condition, __FILE__, __LINE__)
+
+bool checkTestCondition(bool condition, const char *conditionText, const char *fileName, int lineNumber);
+int getTestFailureCount();
+
+void runCatalogTests();
+void runOrderEntryTests();
+void runSalesCountersTests();
+void runTruckConfigurationTests();
+
+#endif // TEST_CHECK_H
@@ -0,0 +1,28 @@
+//================================================================================
+// Name        : tests.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Runs every Rebel Food Truck test group and reports failures
+//================================================================================
+
+#include <iostream>
+
+#include "test_check.h"
+
+int main() {
+    runCatalogTests();
+    runOrderEntryTests();
+    runSalesCountersTests();
+    runTruckConfigurationTests();
+
+    // Report result.
+    int failureCount = getTestFailureCount();
+    if (failureCount > 0) {
+        std::cerr << failureCount << " check(s) failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed." << std::endl;
+
+    return 0;
+}
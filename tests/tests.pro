@@ -0,0 +1,30 @@
+QT -= gui core
+
+CONFIG += c++11 console thread testcase
+CONFIG -= app_bundle qt
+
+INCLUDEPATH += ..
+
+# Lets the tests load the shipped configuration file.
+DEFINES += SOURCE_DIRECTORY=\\\"$$PWD/..\\\"
+
+SOURCES += \
+    catalog_test.cpp \
+    order_entry_test.cpp \
+    sales_counters_test.cpp \
+    test_check.cpp \
+    tests.cpp \
+    truck_configuration_test.cpp \
+    ../catalog.cpp \
+    ../ingredient_lots.cpp \
+    ../order_entry.cpp \
+    ../sales_counters.cpp \
+    ../truck_configuration.cpp
+
+HEADERS += \
+    test_check.h \
+    ../catalog.h \
+    ../ingredient_lots.h \
+    ../order_entry.h \
+    ../sales_counters.h \
+    ../truck_configuration.h
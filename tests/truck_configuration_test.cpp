@@ -0,0 +1,77 @@
+//================================================================================
+// Name        : truck_configuration_test.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Tests of configuration file loading
+//================================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "test_check.h"
+#include "truck_configuration.h"
+
+// Directory holding the shipped configuration file (set by the project file, or the parent of the build directory)
+#ifndef SOURCE_DIRECTORY
+#define SOURCE_DIRECTORY ".."
+#endif
+
+// Scratch configuration file written and removed by the tests
+#define TEST_CONFIGURATION_PATH "truck_configuration_test.cfg"
+
+static configurationError loadTestConfiguration(truckConfiguration &configuration, const char *configurationText, int &errorLine);
+
+/**
+ * @brief runTruckConfigurationTests checks that the shipped configuration file loads as is, that an empty export path
+ *        is accepted while an empty label is not, and that capacities and servings are capped.
+ */
+
+void runTruckConfigurationTests() {
+    truckConfiguration configuration;
+    int errorLine = 0;
+
+    // Shipped configuration
+    setDefaultTruckConfiguration(configuration);
+    TEST_CHECK(loadTruckConfiguration(configuration, SOURCE_DIRECTORY "/" DEFAULT_TRUCK_CONFIGURATION_PATH, errorLine) == CONFIG_SUCCESS);
+    TEST_CHECK(errorLine == 0);
+    TEST_CHECK(configuration.salesExportPath.empty());
+    TEST_CHECK(configuration.hamburgerLabel == "Hamburger");
+    TEST_CHECK(!configuration.isCustomCatalog && configuration.catalog.items.size() == 5);
+
+    // Empty export path disables the export.
+    setDefaultTruckConfiguration(configuration);
+    TEST_CHECK(loadTestConfiguration(configuration, "sales_export_path = export.bin\nsales_export_path =\n", errorLine) == CONFIG_SUCCESS);
+    TEST_CHECK(configuration.salesExportPath.empty());
+
+    // Empty labels are rejected on their line.
+    setDefaultTruckConfiguration(configuration);
+    TEST_CHECK(loadTestConfiguration(configuration, "hotdog_price = 4.00\nhotdog_label =\n", errorLine) == CONFIG_INVALID_VALUE);
+    TEST_CHECK(errorLine == 2);
+
+    // Capacities and chili servings are capped, on key lines and ingredient lines alike.
+    setDefaultTruckConfiguration(configuration);
+    TEST_CHECK(loadTestConfiguration(configuration, "chili_capacity = 1000000000\nchili_self_serving = 1000000\n", errorLine) == CONFIG_SUCCESS);
+    TEST_CHECK(loadTestConfiguration(configuration, "chili_capacity = 1000000001\n", errorLine) == CONFIG_INVALID_VALUE);
+    TEST_CHECK(loadTestConfiguration(configuration, "hotdog_price = 4.00\nchili_addon_serving = 1000001\n", errorLine) == CONFIG_INVALID_VALUE);
+    TEST_CHECK(errorLine == 2);
+    TEST_CHECK(loadTestConfiguration(configuration, "ingredient = RICE | Rice | rice | 9223372036854775807\n", errorLine) == CONFIG_INVALID_CATALOG);
+}
+
+/**
+ * @brief loadTestConfiguration writes configuration text to a scratch file, loads it, and removes the file.
+ * @param configuration = Configuration to load into passed by reference
+ * @param configurationText = Text of the configuration file
+ * @param errorLine = Integer to receive the line of an error passed by reference
+ * @return = configurationError enum representing the result of loading
+ */
+
+static configurationError loadTestConfiguration(truckConfiguration &configuration, const char *configurationText, int &errorLine) {
+    std::ofstream(TEST_CONFIGURATION_PATH, std::ios::binary) << configurationText;
+    errorLine = 0;
+    configurationError loadResult = loadTruckConfiguration(configuration, TEST_CONFIGURATION_PATH, errorLine);
+    std::remove(TEST_CONFIGURATION_PATH);
+
+    return loadResult;
+}
@@ -0,0 +1,618 @@
+//================================================================================
+// Name        : truck_configuration.cpp
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Truck capacities, servings, prices, and menu labels loaded from
+//               a configuration file and hot-swapped while the program runs
+//================================================================================
+
+#include "truck_configuration.h"
+
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Largest configuration file accepted. The whole file is read into one buffer allocated at the file's own size and
+// parsed in place, so a small file needs only a small allocation and a large one never risks the stack.
+static const long MAX_CONFIGURATION_SIZE = 16L * 1024 * 1024;
+
+// Most fields on an "ingredient" or "item" line
+static const int MAX_CATALOG_LINE_FIELDS = 6;
+
+// Longest shelf life accepted in hours (about a century). Keeps expiry times far from integer overflow.
+static const double MAX_SHELF_LIFE_HOURS = 876000.0;
+
+// Reload published by the watcher thread: a parsed configuration, the error of a file that failed to parse, or both
+// when a bad file follows a good one before the menu loops look.
+struct truckReload {
+    truckConfiguration *configuration;
+    std::string errorMessage;
+};
+
+// Reload not yet picked up by the menu loops. Only the menu loops ever read a configuration or print an error, so once
+// a reload is exchanged out of this slot it belongs to them and can be freed without waiting.
+static std::atomic<truckReload *> pendingTruckReload(nullptr);
+
+static char *trimWhitespace(char *stringStart, char *stringEnd);
+static int splitCatalogFields(char *(&fields)[MAX_CATALOG_LINE_FIELDS], char *valueString);
+static bool parseConfigurationInteger(std::int64_t &parsedInteger, const char *valueString, std::int64_t minValue, std::int64_t maxValue);
+static bool parseConfigurationDouble(double &parsedDouble, const char *valueString, double minValue, double maxValue);
+static bool parseConfigurationLabel(std::string &parsedLabel, const char *valueString);
+static std::int64_t getShelfLifeSeconds(double shelfLifeHours);
+static catalogError deriveTruckConfiguration(truckConfiguration &configuration);
+
+/**
+ * @brief setDefaultTruckConfiguration assigns the values the program used before a configuration file existed.
+ * @param configuration = Configuration to receive default values passed by reference
+ */
+
+void setDefaultTruckConfiguration(truckConfiguration &configuration) {
+    // Food truck max capacities for each ingredient
+    configuration.hamburgerPattyCapacity = 200;
+    configuration.hamburgerBunCapacity   =  75;
+    configuration.hotdogCapacity         = 200;
+    configuration.hotdogBunCapacity      =  75;
+    configuration.chiliCapacity          = 500;
+
+    // Hours each ingredient keeps after restocking
+    configuration.hamburgerPattyShelfLife = 0.0;
+    configuration.hamburgerBunShelfLife   = 0.0;
+    configuration.hotdogShelfLife         = 0.0;
+    configuration.hotdogBunShelfLife      = 0.0;
+    configuration.chiliShelfLife          = 0.0;
+
+    // Serving amount for each chili type
+    configuration.chiliSelfServing  = 12;
+    configuration.chiliAddonServing =  4;
+
+    // Low inventory threshold
+    configuration.lowInventoryThreshold = 0.2;
+
+    // Item prices
+    configuration.hamburgerPrice  = 5.00;
+    configuration.hotdogPrice     = 5.00;
+    configuration.chiliSelfPrice  = 4.00;
+    configuration.chiliAddonPrice = 2.00;
+
+    // Sales tax
+    configuration.salesTax = 0.05;
+
+    // Menu labels
+    configuration.hamburgerLabel   = "Hamburger";
+    configuration.chiliburgerLabel = "Chiliburger";
+    configuration.hotdogLabel      = "Hotdog";
+    configuration.chilidogLabel    = "Chilidog";
+    configuration.chiliSelfLabel   = "Chili";
+
+    // Sales export
+    configuration.salesExportPath = "";
+
+    // Built-in menu
+    configuration.isCustomCatalog = false;
+    deriveTruckConfiguration(configuration);
+}
+
+/**
+ * @brief loadTruckConfiguration parses a "key = value" configuration file in a single pass over one buffer. Keys
+ *        missing from the file keep the value already in the configuration. On error, the configuration is untouched.
+ *        "ingredient" and "item" lines may repeat and together replace the built-in menu:
+ *            ingredient = CODE | Label | prompt name | capacity [| unit [| shelf life hours]]
+ *            item       = CODE | Label | plural name | price | INGREDIENT:amount ...
+ * @param configuration = Configuration to receive parsed values passed by reference
+ * @param configurationPath = Path of the configuration file
+ * @param errorLine = Integer to receive the line number of a key or value error passed by reference (0 otherwise)
+ * @return = configurationError enum representing the result of loading the file
+ */
+
+configurationError loadTruckConfiguration(truckConfiguration &configuration, const char *configurationPath, int &errorLine) {
+    errorLine = 0;
+
+    // Read the whole file at once.
+    std::FILE *configurationFile = std::fopen(configurationPath, "rb");
+    if (configurationFile == nullptr) {
+        return CONFIG_UNREADABLE;
+    }
+    long fileSize = -1;
+    if (std::fseek(configurationFile, 0, SEEK_END) == 0) {
+        fileSize = std::ftell(configurationFile);
+        std::rewind(configurationFile);
+    }
+    if (fileSize < 0) {
+        std::fclose(configurationFile);
+        return CONFIG_UNREADABLE;
+    } else if (fileSize > MAX_CONFIGURATION_SIZE) {
+        std::fclose(configurationFile);
+        return CONFIG_TOO_LARGE;
+    }
+
+    // Buffer holding the whole file plus a terminating null character
+    std::vector<char> buffer(static_cast<size_t>(fileSize) + 1);
+    size_t bufferLength = std::fread(buffer.data(), 1, static_cast<size_t>(fileSize), configurationFile);
+    bool isReadError = std::ferror(configurationFile) != 0;
+    std::fclose(configurationFile);
+    if (isReadError) {
+        return CONFIG_UNREADABLE;
+    }
+    buffer[bufferLength] = '\0';
+
+    // Parse into a copy so a bad file never leaves a half-updated configuration.
+    truckConfiguration parsedConfiguration = configuration;
+
+    char *lineStart = buffer.data();
+    char *bufferEnd = buffer.data() + bufferLength;
+    int lineNumber = 0;
+    while (lineStart < bufferEnd) {
+        // Find end of line and terminate it in place.
+        char *lineEnd = static_cast<char *>(std::memchr(lineStart, '\n', bufferEnd - lineStart));
+        if (lineEnd == nullptr) {
+            lineEnd = bufferEnd;
+        }
+        *lineEnd = '\0';
+        ++lineNumber;
+
+        // Strip comment.
+        char *commentStart = std::strchr(lineStart, '#');
+        if (commentStart != nullptr) {
+            *commentStart = '\0';
+        } else {
+            commentStart = lineEnd;
+        }
+
+        char *separator = std::strchr(lineStart, '=');
+        char *key = trimWhitespace(lineStart, separator != nullptr ? separator : commentStart);
+        if (*key != '\0') {
+            // Lines with text must be key/value pairs.
+            if (separator == nullptr) {
+                errorLine = lineNumber;
+                return CONFIG_INVALID_VALUE;
+            }
+            char *value = trimWhitespace(separator + 1, commentStart);
+
+            bool isValidValue = true;
+            if (std::strcmp(key, "hamburger_patty_capacity") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.hamburgerPattyCapacity, value, 1, MAX_CATALOG_CAPACITY);
+            } else if (std::strcmp(key, "hamburger_bun_capacity") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.hamburgerBunCapacity, value, 1, MAX_CATALOG_CAPACITY);
+            } else if (std::strcmp(key, "hotdog_capacity") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.hotdogCapacity, value, 1, MAX_CATALOG_CAPACITY);
+            } else if (std::strcmp(key, "hotdog_bun_capacity") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.hotdogBunCapacity, value, 1, MAX_CATALOG_CAPACITY);
+            } else if (std::strcmp(key, "chili_capacity") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.chiliCapacity, value, 1, MAX_CATALOG_CAPACITY);
+            } else if (std::strcmp(key, "hamburger_patty_shelf_life_hours") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hamburgerPattyShelfLife, value, 0.0, MAX_SHELF_LIFE_HOURS);
+            } else if (std::strcmp(key, "hamburger_bun_shelf_life_hours") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hamburgerBunShelfLife, value, 0.0, MAX_SHELF_LIFE_HOURS);
+            } else if (std::strcmp(key, "hotdog_shelf_life_hours") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hotdogShelfLife, value, 0.0, MAX_SHELF_LIFE_HOURS);
+            } else if (std::strcmp(key, "hotdog_bun_shelf_life_hours") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hotdogBunShelfLife, value, 0.0, MAX_SHELF_LIFE_HOURS);
+            } else if (std::strcmp(key, "chili_shelf_life_hours") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.chiliShelfLife, value, 0.0, MAX_SHELF_LIFE_HOURS);
+            } else if (std::strcmp(key, "chili_self_serving") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.chiliSelfServing, value, 1, MAX_CATALOG_RECIPE_AMOUNT);
+            } else if (std::strcmp(key, "chili_addon_serving") == 0) {
+                isValidValue = parseConfigurationInteger(parsedConfiguration.chiliAddonServing, value, 1, MAX_CATALOG_RECIPE_AMOUNT);
+            } else if (std::strcmp(key, "low_inventory_threshold") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.lowInventoryThreshold, value, 0.0, 1.0);
+            } else if (std::strcmp(key, "hamburger_price") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hamburgerPrice, value, 0.0, HUGE_VAL);
+            } else if (std::strcmp(key, "hotdog_price") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.hotdogPrice, value, 0.0, HUGE_VAL);
+            } else if (std::strcmp(key, "chili_self_price") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.chiliSelfPrice, value, 0.0, HUGE_VAL);
+            } else if (std::strcmp(key, "chili_addon_price") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.chiliAddonPrice, value, 0.0, HUGE_VAL);
+            } else if (std::strcmp(key, "sales_tax") == 0) {
+                isValidValue = parseConfigurationDouble(parsedConfiguration.salesTax, value, 0.0, 1.0);
+            } else if (std::strcmp(key, "hamburger_label") == 0) {
+                isValidValue = parseConfigurationLabel(parsedConfiguration.hamburgerLabel, value);
+            } else if (std::strcmp(key, "chiliburger_label") == 0) {
+                isValidValue = parseConfigurationLabel(parsedConfiguration.chiliburgerLabel, value);
+            } else if (std::strcmp(key, "hotdog_label") == 0) {
+                isValidValue = parseConfigurationLabel(parsedConfiguration.hotdogLabel, value);
+            } else if (std::strcmp(key, "chilidog_label") == 0) {
+                isValidValue = parseConfigurationLabel(parsedConfiguration.chilidogLabel, value);
+            } else if (std::strcmp(key, "chili_self_label") == 0) {
+                isValidValue = parseConfigurationLabel(parsedConfiguration.chiliSelfLabel, value);
+            } else if (std::strcmp(key, "sales_export_path") == 0) {
+                // Empty path disables the export.
+                parsedConfiguration.salesExportPath = value;
+            } else if (std::strcmp(key, "ingredient") == 0 || std::strcmp(key, "item") == 0) {
+                // First catalog line replaces the built-in menu.
+                if (!parsedConfiguration.isCustomCatalog) {
+                    clearCatalog(parsedConfiguration.catalog);
+                    parsedConfiguration.isCustomCatalog = true;
+                }
+
+                char *fields[MAX_CATALOG_LINE_FIELDS];
+                int fieldCount = splitCatalogFields(fields, value);
+                catalogError catalogResult = CATALOG_INVALID_VALUE;
+                if (key[1] == 'n' && fieldCount >= 4 && fieldCount <= 6) { // Ingredient
+                    std::int64_t capacity = 0;
+                    double shelfLifeHours = 0.0;
+                    if (parseConfigurationInteger(capacity, fields[3], 1, MAX_CATALOG_CAPACITY) && (fieldCount < 6 || parseConfigurationDouble(shelfLifeHours, fields[5], 0.0, MAX_SHELF_LIFE_HOURS))) {
+                        catalogResult = addCatalogIngredient(parsedConfiguration.catalog, fields[0], fields[1], fields[2], fieldCount >= 5 ? fields[4] : "", capacity, getShelfLifeSeconds(shelfLifeHours));
+                    }
+                } else if (key[1] == 't' && fieldCount == 5) { // Item
+                    double price = 0;
+                    if (parseConfigurationDouble(price, fields[3], 0.0, HUGE_VAL)) {
+                        catalogResult = addCatalogItem(parsedConfiguration.catalog, fields[0], fields[1], fields[2], price, fields[4]);
+                    }
+                }
+
+                if (catalogResult != CATALOG_SUCCESS) {
+                    errorLine = lineNumber;
+                    return CONFIG_INVALID_CATALOG;
+                }
+            } else {
+                errorLine = lineNumber;
+                return CONFIG_UNKNOWN_KEY;
+            }
+
+            if (!isValidValue) {
+                errorLine = lineNumber;
+                return CONFIG_INVALID_VALUE;
+            }
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    // A custom catalog must have something to sell. The built-in one is rebuilt from the values just parsed.
+    if (parsedConfiguration.isCustomCatalog && parsedConfiguration.catalog.items.empty()) {
+        return CONFIG_INVALID_CATALOG;
+    } else if (deriveTruckConfiguration(parsedConfiguration) != CATALOG_SUCCESS) {
+        return CONFIG_INVALID_VALUE;
+    }
+    configuration = parsedConfiguration;
+
+    return CONFIG_SUCCESS;
+}
+
+/**
+ * @brief getConfigurationErrorMessage returns a printable description of a configuration error.
+ * @param errorResult = configurationError enum to describe
+ * @return = Null-terminated byte string constant describing the error
+ */
+
+const char *getConfigurationErrorMessage(configurationError errorResult) {
+    if (errorResult == CONFIG_SUCCESS) {
+        return "Configuration loaded.";
+    } else if (errorResult == CONFIG_UNREADABLE) {
+        return "Configuration file could not be read.";
+    } else if (errorResult == CONFIG_TOO_LARGE) {
+        return "Configuration file is too large.";
+    } else if (errorResult == CONFIG_UNKNOWN_KEY) {
+        return "Configuration file contains an unknown key.";
+    } else if (errorResult == CONFIG_INVALID_CATALOG) {
+        return "Configuration file contains an invalid ingredient or item.";
+    } else {
+        return "Configuration file contains an invalid value.";
+    }
+}
+
+/**
+ * @brief acquireTruckConfiguration picks up a reload published by the watcher, if any. A new configuration replaces the
+ *        current one, which is handed back so the caller can carry inventory over by code before freeing it. The error
+ *        of a file that failed to parse is handed back for the caller to print. Must only be called from the menu loops
+ *        at the start of a pass, when no reference into the current configuration is held. Costs a single relaxed load
+ *        when nothing changed and one pointer exchange otherwise.
+ * @param currentConfiguration = Pointer to the configuration in use passed by reference
+ * @param replacedConfiguration = Pointer to receive the configuration replaced passed by reference (caller deletes it)
+ * @param reloadErrorMessage = String to receive the reload error passed by reference (empty if none)
+ * @return = Boolean indicating whether the configuration was replaced
+ */
+
+bool acquireTruckConfiguration(const truckConfiguration *&currentConfiguration, const truckConfiguration *&replacedConfiguration, std::string &reloadErrorMessage) {
+    reloadErrorMessage.clear();
+    if (pendingTruckReload.load(std::memory_order_relaxed) == nullptr) {
+        return false;
+    }
+
+    truckReload *reload = pendingTruckReload.exchange(nullptr, std::memory_order_acquire);
+    if (reload == nullptr) {
+        return false;
+    }
+
+    reloadErrorMessage.swap(reload->errorMessage);
+    const bool isConfigurationReplaced = reload->configuration != nullptr;
+    if (isConfigurationReplaced) {
+        replacedConfiguration = currentConfiguration;
+        currentConfiguration = reload->configuration;
+    }
+    delete reload;
+
+    return isConfigurationReplaced;
+}
+
+#ifdef __linux__
+/**
+ * @brief watchTruckConfiguration blocks on inotify events for the configuration file's directory and publishes each
+ *        successfully parsed version of the file. Watching the directory also catches editors that save by rename.
+ * @param configurationPath = Path of the configuration file passed by value
+ * @param inotifyDescriptor = inotify instance already watching the file's directory
+ */
+
+static void watchTruckConfiguration(std::string configurationPath, int inotifyDescriptor) {
+    // File name portion of path to match against event names
+    std::string::size_type slashPosition = configurationPath.rfind('/');
+    std::string configurationName = slashPosition == std::string::npos ? configurationPath : configurationPath.substr(slashPosition + 1);
+
+    // Buffer for a batch of events
+    alignas(inotify_event) char eventBuffer[4096];
+
+    for (;;) {
+        ssize_t eventLength = read(inotifyDescriptor, eventBuffer, sizeof(eventBuffer));
+        if (eventLength < 0 && errno == EINTR) {
+            continue;
+        } else if (eventLength <= 0) {
+            break;
+        }
+
+        // Determine if any event in the batch touched the configuration file.
+        bool isConfigurationChanged = false;
+        for (char *eventPointer = eventBuffer; eventPointer < eventBuffer + eventLength; ) {
+            const inotify_event *event = reinterpret_cast<const inotify_event *>(eventPointer);
+            if (event->len > 0 && configurationName == event->name) {
+                isConfigurationChanged = true;
+            }
+            eventPointer += sizeof(inotify_event) + event->len;
+        }
+
+        if (!isConfigurationChanged) {
+            continue;
+        }
+
+        // Parse new configuration on top of defaults so removed keys revert.
+        truckReload *reload = new truckReload;
+        reload->configuration = new truckConfiguration;
+        setDefaultTruckConfiguration(*reload->configuration);
+        int errorLine = 0;
+        configurationError errorResult = loadTruckConfiguration(*reload->configuration, configurationPath.c_str(), errorLine);
+
+        // Take back a reload still pending. It was never seen by the menu loops, so it can be freed right away.
+        truckReload *pendingReload = pendingTruckReload.exchange(nullptr, std::memory_order_acquire);
+
+        // Hand the error to the menu loops to print between screens. A configuration still pending stays pending.
+        if (errorResult != CONFIG_SUCCESS) {
+            delete reload->configuration;
+            reload->configuration = nullptr;
+            if (pendingReload != nullptr) {
+                std::swap(reload->configuration, pendingReload->configuration);
+            }
+            reload->errorMessage = std::string("\n") + getConfigurationErrorMessage(errorResult);
+            if (errorLine > 0) {
+                reload->errorMessage += " (line " + std::to_string(errorLine) + ")";
+            }
+            reload->errorMessage += " Keeping current configuration.\n";
+        }
+        if (pendingReload != nullptr) {
+            delete pendingReload->configuration;
+            delete pendingReload;
+        }
+
+        // Publish.
+        pendingTruckReload.store(reload, std::memory_order_release);
+    }
+
+    close(inotifyDescriptor);
+}
+#endif
+
+/**
+ * @brief startTruckConfigurationWatcher starts a background thread that reloads the configuration file when it changes.
+ * @param configurationPath = Path of the configuration file
+ * @return = Boolean indicating whether the watcher was started (always false on platforms without inotify)
+ */
+
+bool startTruckConfigurationWatcher(const char *configurationPath) {
+#ifdef __linux__
+    // Directory portion of path to watch
+    std::string configurationDirectory = configurationPath;
+    std::string::size_type slashPosition = configurationDirectory.rfind('/');
+    if (slashPosition == std::string::npos) {
+        configurationDirectory = ".";
+    } else if (slashPosition == 0) {
+        configurationDirectory = "/";
+    } else {
+        configurationDirectory.erase(slashPosition);
+    }
+
+    int inotifyDescriptor = inotify_init1(IN_CLOEXEC);
+    if (inotifyDescriptor < 0) {
+        return false;
+    }
+    if (inotify_add_watch(inotifyDescriptor, configurationDirectory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(inotifyDescriptor);
+        return false;
+    }
+
+    std::thread(watchTruckConfiguration, std::string(configurationPath), inotifyDescriptor).detach();
+
+    return true;
+#else
+    (void)configurationPath;
+
+    return false;
+#endif
+}
+
+/**
+ * @brief trimWhitespace null-terminates a substring with leading and trailing whitespace removed.
+ * @param stringStart = Pointer to first character of substring
+ * @param stringEnd = Pointer past last character of substring
+ * @return = Pointer to first non-whitespace character
+ */
+
+static char *trimWhitespace(char *stringStart, char *stringEnd) {
+    while (stringStart < stringEnd && (*stringStart == ' ' || *stringStart == '\t')) {
+        ++stringStart;
+    }
+    while (stringEnd > stringStart && (stringEnd[-1] == ' ' || stringEnd[-1] == '\t' || stringEnd[-1] == '\r')) {
+        --stringEnd;
+    }
+    *stringEnd = '\0';
+
+    return stringStart;
+}
+
+/**
+ * @brief splitCatalogFields splits an "ingredient" or "item" value at '|' characters in place and trims each field.
+ * @param fields = Array to receive pointers to fields passed by reference
+ * @param valueString = Null-terminated value to split
+ * @return = Integer with number of fields (MAX_CATALOG_LINE_FIELDS + 1 if there are too many)
+ */
+
+static int splitCatalogFields(char *(&fields)[MAX_CATALOG_LINE_FIELDS], char *valueString) {
+    int fieldCount = 0;
+    char *fieldStart = valueString;
+    for (;;) {
+        char *fieldEnd = std::strchr(fieldStart, '|');
+        bool isLastField = fieldEnd == nullptr;
+        if (isLastField) {
+            fieldEnd = fieldStart + std::strlen(fieldStart);
+        }
+        if (fieldCount == MAX_CATALOG_LINE_FIELDS) {
+            return MAX_CATALOG_LINE_FIELDS + 1;
+        }
+        fields[fieldCount++] = trimWhitespace(fieldStart, fieldEnd);
+        if (isLastField) {
+            return fieldCount;
+        }
+        fieldStart = fieldEnd + 1;
+    }
+}
+
+/**
+ * @brief parseConfigurationInteger parses a whole-string integer between minValue and maxValue.
+ * @param parsedInteger = 64-bit integer to receive parsed result passed by reference
+ * @param valueString = Null-terminated byte string constant to be interpreted
+ * @param minValue = Minimum valid integer value
+ * @param maxValue = Maximum valid integer value
+ * @return = Boolean indicating whether the value was valid
+ */
+
+static bool parseConfigurationInteger(std::int64_t &parsedInteger, const char *valueString, std::int64_t minValue, std::int64_t maxValue) {
+    char *end;
+    errno = 0;
+    long long longLongToParse = std::strtoll(valueString, &end, 10);
+
+    if (errno == ERANGE || *valueString == '\0' || *end != '\0' || longLongToParse < minValue || longLongToParse > maxValue) {
+        return false;
+    }
+
+    parsedInteger = static_cast<std::int64_t>(longLongToParse);
+
+    return true;
+}
+
+/**
+ * @brief parseConfigurationDouble parses a whole-string floating-point number between minValue and maxValue.
+ * @param parsedDouble = Double to receive parsed result passed by reference
+ * @param valueString = Null-terminated byte string constant to be interpreted
+ * @param minValue = Minimum valid value
+ * @param maxValue = Maximum valid value
+ * @return = Boolean indicating whether the value was valid
+ */
+
+static bool parseConfigurationDouble(double &parsedDouble, const char *valueString, double minValue, double maxValue) {
+    char *end;
+    errno = 0;
+    double doubleToParse = std::strtod(valueString, &end);
+
+    if (errno == ERANGE || *valueString == '\0' || *end != '\0' || !(doubleToParse >= minValue && doubleToParse <= maxValue) || std::isinf(doubleToParse)) {
+        return false;
+    }
+
+    parsedDouble = doubleToParse;
+
+    return true;
+}
+
+/**
+ * @brief parseConfigurationLabel parses a menu label, which may not be empty.
+ * @param parsedLabel = String to receive parsed result passed by reference
+ * @param valueString = Null-terminated byte string constant to be interpreted
+ * @return = Boolean indicating whether the value was valid
+ */
+
+static bool parseConfigurationLabel(std::string &parsedLabel, const char *valueString) {
+    if (*valueString == '\0') {
+        return false;
+    }
+
+    parsedLabel = valueString;
+
+    return true;
+}
+
+/**
+ * @brief getShelfLifeSeconds converts a shelf life in hours to whole seconds, rounding up so a short shelf life never
+ *        becomes 0 (never expires).
+ * @param shelfLifeHours = Shelf life in hours (0 = never expires)
+ * @return = Shelf life in seconds
+ */
+
+static std::int64_t getShelfLifeSeconds(double shelfLifeHours) {
+    return static_cast<std::int64_t>(std::ceil(shelfLifeHours * 3600.0));
+}
+
+/**
+ * @brief deriveTruckConfiguration builds the built-in menu from the loaded values, unless the file has its own catalog,
+ *        and finalizes the catalog.
+ * @param configuration = Configuration to update passed by reference
+ * @return = catalogError enum representing the result of building the built-in menu
+ */
+
+static catalogError deriveTruckConfiguration(truckConfiguration &configuration) {
+    catalogError errorResult = CATALOG_SUCCESS;
+
+    if (!configuration.isCustomCatalog) {
+        truckCatalog &catalog = configuration.catalog;
+        clearCatalog(catalog);
+
+        // Recipes for each item
+        std::string chiliburgerRecipe = "PATTY:1 BUN:1 CHILI:" + std::to_string(configuration.chiliAddonServing);
+        std::string chilidogRecipe    = "HOTDOG:1 DOGBUN:1 CHILI:" + std::to_string(configuration.chiliAddonServing);
+        std::string chiliSelfRecipe   = "CHILI:" + std::to_string(configuration.chiliSelfServing);
+        std::string chiliSelfLabel    = configuration.chiliSelfLabel + " (" + std::to_string(configuration.chiliSelfServing) + " oz)";
+
+        // Ingredients, then items in sell menu order. Codes never fail, but labels may be empty.
+        addCatalogIngredient(catalog, "PATTY",  "Hamburger Patties", "hamburger patty", "",   configuration.hamburgerPattyCapacity, getShelfLifeSeconds(configuration.hamburgerPattyShelfLife));
+        addCatalogIngredient(catalog, "BUN",    "Hamburger Buns",    "hamburger bun",   "",   configuration.hamburgerBunCapacity,   getShelfLifeSeconds(configuration.hamburgerBunShelfLife));
+        addCatalogIngredient(catalog, "HOTDOG", "Hotdogs",           "hotdog",          "",   configuration.hotdogCapacity,         getShelfLifeSeconds(configuration.hotdogShelfLife));
+        addCatalogIngredient(catalog, "DOGBUN", "Hotdog Buns",       "hotdog bun",      "",   configuration.hotdogBunCapacity,      getShelfLifeSeconds(configuration.hotdogBunShelfLife));
+        addCatalogIngredient(catalog, "CHILI",  "Chili",             "chili",           "oz", configuration.chiliCapacity,          getShelfLifeSeconds(configuration.chiliShelfLife));
+
+        const catalogError itemResults[] = {
+            addCatalogItem(catalog, "BURGER",      configuration.hamburgerLabel,   "hamburgers",   configuration.hamburgerPrice,                                   "PATTY:1 BUN:1"),
+            addCatalogItem(catalog, "CHILIBURGER", configuration.chiliburgerLabel, "chiliburgers", configuration.hamburgerPrice + configuration.chiliAddonPrice, chiliburgerRecipe.c_str()),
+            addCatalogItem(catalog, "DOG",         configuration.hotdogLabel,      "hotdogs",      configuration.hotdogPrice,                                      "HOTDOG:1 DOGBUN:1"),
+            addCatalogItem(catalog, "CHILIDOG",    configuration.chilidogLabel,    "chilidogs",    configuration.hotdogPrice + configuration.chiliAddonPrice,    chilidogRecipe.c_str()),
+            addCatalogItem(catalog, "CHILIBOWL",   chiliSelfLabel,                 "chili",        configuration.chiliSelfPrice,                                   chiliSelfRecipe.c_str())
+        };
+        for (int i = 0; i < 5; ++i) {
+            if (itemResults[i] != CATALOG_SUCCESS) {
+                errorResult = itemResults[i];
+            }
+        }
+    }
+
+    finalizeCatalog(configuration.catalog, configuration.lowInventoryThreshold);
+
+    return errorResult;
+}
@@ -0,0 +1,79 @@
+//================================================================================
+// Name        : truck_configuration.h
+// Author      : Noah Allan Ertz (NAE)
+// Email       : naertz@dmacc.edu
+// Date        : 2026-10-18
+// Description : Truck capacities, servings, prices, and menu labels loaded from
+//               a configuration file and hot-swapped while the program runs
+//================================================================================
+
+#ifndef TRUCK_CONFIGURATION_H
+#define TRUCK_CONFIGURATION_H
+
+#include <cstdint>
+#include <string>
+
+#include "catalog.h"
+
+// Default configuration file read at startup when no path is given.
+#define DEFAULT_TRUCK_CONFIGURATION_PATH "rebel_food_truck.cfg"
+
+enum configurationError { CONFIG_SUCCESS, CONFIG_UNREADABLE, CONFIG_TOO_LARGE, CONFIG_UNKNOWN_KEY, CONFIG_INVALID_VALUE, CONFIG_INVALID_CATALOG };
+
+// Values that used to be compile-time constants in main(). A configuration is never modified once published.
+// The capacity, serving, price, and label values describe the built-in menu. A file with "ingredient" and "item" lines
+// replaces the built-in menu with its own catalog, and those values are then unused.
+struct truckConfiguration {
+    // Food truck max capacities for each ingredient
+    std::int64_t hamburgerPattyCapacity;
+    std::int64_t hamburgerBunCapacity;
+    std::int64_t hotdogCapacity;
+    std::int64_t hotdogBunCapacity;
+    std::int64_t chiliCapacity;
+
+    // Hours each ingredient keeps after restocking (0 = never expires)
+    double hamburgerPattyShelfLife;
+    double hamburgerBunShelfLife;
+    double hotdogShelfLife;
+    double hotdogBunShelfLife;
+    double chiliShelfLife;
+
+    // Serving amount for each chili type
+    std::int64_t chiliSelfServing;
+    std::int64_t chiliAddonServing;
+
+    // Low inventory threshold as a fraction of capacity
+    double lowInventoryThreshold;
+
+    // Item prices
+    double hamburgerPrice;
+    double hotdogPrice;
+    double chiliSelfPrice;
+    double chiliAddonPrice;
+
+    // Sales tax
+    double salesTax;
+
+    // Menu labels
+    std::string hamburgerLabel;
+    std::string chiliburgerLabel;
+    std::string hotdogLabel;
+    std::string chilidogLabel;
+    std::string chiliSelfLabel;
+
+    // File order events are exported to for upload (empty = no export)
+    std::string salesExportPath;
+
+    // Ingredients and items for sale, built from the values above or from the file's own catalog
+    bool isCustomCatalog;
+    truckCatalog catalog;
+};
+
+void setDefaultTruckConfiguration(truckConfiguration &configuration);
+configurationError loadTruckConfiguration(truckConfiguration &configuration, const char *configurationPath, int &errorLine);
+const char *getConfigurationErrorMessage(configurationError errorResult);
+
+bool startTruckConfigurationWatcher(const char *configurationPath);
+bool acquireTruckConfiguration(const truckConfiguration *&currentConfiguration, const truckConfiguration *&replacedConfiguration, std::string &reloadErrorMessage);
+
+#endif // TRUCK_CONFIGURATION_H